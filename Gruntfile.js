@@ -96,6 +96,15 @@ module.exports = function(grunt) {
         jasmine: {
           command: "./node_modules/jasmine/bin/jasmine.js"
         },
+        benchmarkKeys: {
+          command: runNode("bin/benchmark_keys.js")
+        },
+        buildBenchmarks: {
+          command: './node_modules/.bin/node-pre-gyp build --build_benchmarks=true'
+        },
+        benchmarkConversions: {
+          command: runNode("spec/cpp/benchmark.js")
+        },
         release: {
           command: "./node_modules/.bin/node-pre-gyp rebuild package testpackage publish"
         },
@@ -124,6 +133,7 @@ module.exports = function(grunt) {
   grunt.registerTask('test', ['build', /*'shell:cppUnitTests',*/ 'server:ensure', 'server:deploy', 'shell:jasmine', 'locator:shutdown']);
   grunt.registerTask('lint', ['shell:lint', 'jshint']);
   grunt.registerTask('console', ['build', 'shell:console']);
+  grunt.registerTask('benchmark', ['build', 'shell:benchmarkKeys', 'shell:buildBenchmarks', 'shell:benchmarkConversions']);
   grunt.registerTask('license_finder', ['shell:licenseFinder']);
 
   grunt.registerTask('server:start', ['locator:ensure', 'shell:startServer']);
@@ -0,0 +1,77 @@
+#!/usr/bin/env node
+
+// Measures key-heavy putAll/getAll throughput against a LOCAL region, so no server is needed.
+// ASCII keys take the one-byte string path; the wide keys exercise the UTF-16 <-> wchar_t kernels.
+//
+// Each measurement is also run in a child process with NODE_GEMFIRE_STRING_FAST_PATHS=0, which
+// turns off the one-byte paths and the SIMD kernels, and the two are printed side by side.
+//
+// Usage: bin/benchmark_keys.js [keyCount] [iterations]
+
+const _ = require("lodash");
+const childProcess = require("child_process");
+const gemfire = require("../spec/support/gemfire.js");
+
+const keyCount = parseInt(process.argv[2] || "10000", 10);
+const iterations = parseInt(process.argv[3] || "20", 10);
+const baselineOnly = process.argv[4] === "--baseline";
+
+const cache = gemfire.createCacheFactory().create();
+const region = cache.createRegion("benchmarkKeys", {type: "LOCAL"});
+
+function keys(prefix) {
+  return _.times(keyCount, function(i) { return prefix + "-key-" + i; });
+}
+
+function entries(keyList) {
+  return _.zipObject(keyList, _.map(keyList, function(key) { return key + "-value"; }));
+}
+
+function measure(fn) {
+  fn();
+
+  const start = process.hrtime();
+  for (var i = 0; i < iterations; i++) {
+    fn();
+  }
+  const elapsed = process.hrtime(start);
+  const nanoseconds = elapsed[0] * 1e9 + elapsed[1];
+  return nanoseconds / (iterations * keyCount);
+}
+
+const results = {};
+_.each({ ascii: "tenant", wide: "ténānt中" }, function(prefix, label) {
+  const keyList = keys(prefix);
+  const object = entries(keyList);
+
+  results[label + " putAllSync"] = measure(function() { region.putAllSync(object); });
+  results[label + " getAllSync"] = measure(function() { region.getAllSync(keyList); });
+});
+
+cache.close();
+
+if (baselineOnly) {
+  console.log(JSON.stringify(results));
+  process.exit(0);
+}
+
+const baseline = JSON.parse(childProcess.execFileSync(
+  process.execPath,
+  [__filename, keyCount, iterations, "--baseline"],
+  { env: _.assign({}, process.env, { NODE_GEMFIRE_STRING_FAST_PATHS: "0" }) }
+).toString());
+
+console.log(
+  _.padEnd("", 24) +
+  _.padStart("baseline", 16) +
+  _.padStart("fast paths", 16) +
+  _.padStart("speedup", 10)
+);
+_.each(results, function(nsPerKey, label) {
+  console.log(
+    _.padEnd(label, 24) +
+    _.padStart(baseline[label].toFixed(1) + " ns/key", 16) +
+    _.padStart(nsPerKey.toFixed(1) + " ns/key", 16) +
+    _.padStart((baseline[label] / nsPerKey).toFixed(2) + "x", 10)
+  );
+});
@@ -1,7 +1,8 @@
 # vim: set ft=javascript
 {
   'variables': {
-    'Build_Debug%': 'false'
+    'Build_Debug%': 'false',
+    'build_benchmarks%': 'false'
   },
   "target_defaults": {
     "include_dirs" : [
@@ -26,10 +27,19 @@
       "src/dependencies.cpp",
       "src/exceptions.cpp",
       "src/conversions.cpp",
+      "src/string_transcoding.cpp",
+      "src/decoded_value.cpp",
+      "src/pdx_shapes.cpp",
       "src/cache.cpp",
       "src/region.cpp",
+      "src/loop_batcher.cpp",
+      "src/put_coalescer.cpp",
+      "src/get_batcher.cpp",
+      "src/pipelined_put_all.cpp",
       "src/select_results.cpp",
+      "src/region_iterator.cpp",
       "src/gemfire_worker.cpp",
+      "src/thread_pool.cpp",
       "src/streaming_result_collector.cpp",
       "src/result_stream.cpp",
       "src/events.cpp",
@@ -65,5 +75,17 @@
         }
       ]
     },
+  ],
+  "conditions": [
+    # Conversion microbenchmarks; build with --build_benchmarks=true and run spec/cpp/benchmark.js
+    ["build_benchmarks=='true'", {
+      "targets": [
+        {
+          "target_name": "benchmark",
+          "sources": [ "spec/cpp/benchmark.cpp" ],
+          "ldflags": [ "-Wl,-Bsymbolic" ]
+        }
+      ]
+    }]
   ]
 }
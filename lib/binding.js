@@ -61,10 +61,67 @@ module.exports = function binding(options) {
     return cacheSingleton;
   };
 
+  const RegionIterator = gemfire.RegionIterator;
+
+  if (typeof Symbol.asyncIterator === "symbol") {
+    RegionIterator.prototype[Symbol.asyncIterator] = function() {
+      const iterator = this;
+      return {
+        next: function() {
+          return new Promise(function(resolve, reject) {
+            iterator.next(function(error, chunk) {
+              if (error) {
+                reject(error);
+              } else {
+                resolve(chunk === null ? { done: true, value: undefined } : { done: false, value: chunk });
+              }
+            });
+          });
+        },
+        return: function() {
+          iterator.close();
+          return Promise.resolve({ done: true, value: undefined });
+        }
+      };
+    };
+  }
+
   delete gemfire.Cache;
   delete gemfire.CacheFactory;
   inherits(gemfire.Region, EventEmitter);
+
+  // Regions watch their own newListener and removeListener events to capture entry events only
+  // while they have listeners, so removing listeners must leave those two in place.
+  function isCaptureListener(listener) {
+    return listener.gemfireCaptureListener === true;
+  }
+
+  gemfire.Region.prototype.removeListener = function removeListener(eventName, listener) {
+    if (typeof listener === "function" && isCaptureListener(listener)) {
+      return this;
+    }
+    return EventEmitter.prototype.removeListener.apply(this, arguments);
+  };
+  gemfire.Region.prototype.off = gemfire.Region.prototype.removeListener;
+
+  gemfire.Region.prototype.removeAllListeners = function removeAllListeners(eventName) {
+    const eventNames = arguments.length > 0 ? [eventName] : this.eventNames();
+
+    eventNames.forEach(function(name) {
+      if (name === "newListener" || name === "removeListener") {
+        this.listeners(name).forEach(function(listener) {
+          if (!isCaptureListener(listener)) {
+            EventEmitter.prototype.removeListener.call(this, name, listener);
+          }
+        }, this);
+      } else {
+        EventEmitter.prototype.removeAllListeners.call(this, name);
+      }
+    }, this);
+    return this;
+  };
   delete gemfire.Region;
+  delete gemfire.RegionIterator;
 
   return gemfire;
 };
@@ -584,6 +584,199 @@ describe("gemfire.Cache", function() {
     });
   });
 
+  describe(".setConversionOptions", function() {
+    const hasBigInt = typeof BigInt === "function";
+    var cache, region;
+
+    beforeEach(function(done) {
+      cache = factories.getCache();
+      region = cache.getRegion("exampleRegion");
+      region.clear(done);
+    });
+
+    afterEach(function() {
+      cache.setConversionOptions({
+        int64: "number",
+        numbers: "double",
+        dictionaryKeyCount: 0,
+        dictionaryIntegerKeys: false,
+        dictionaryType: "object",
+        longFields: []
+      });
+    });
+
+    it("defaults to returning 64 bit integers as numbers, storing numbers as doubles and objects as PDX", function() {
+      expect(cache.getConversionOptions()).toEqual({
+        int64: "number",
+        numbers: "double",
+        dictionaryKeyCount: 0,
+        dictionaryIntegerKeys: false,
+        dictionaryType: "object",
+        longFields: []
+      });
+    });
+
+    it("requires an options object", function() {
+      expect(function() { cache.setConversionOptions(); }).toThrow(
+        new Error("setConversionOptions: You must pass an options object.")
+      );
+    });
+
+    it("rejects unknown int64 modes", function() {
+      expect(function() { cache.setConversionOptions({ int64: "string" }); }).toThrow(
+        new Error("setConversionOptions: int64 must be \"number\" or \"bigint\".")
+      );
+    });
+
+    it("rejects unknown number modes", function() {
+      expect(function() { cache.setConversionOptions({ numbers: "float" }); }).toThrow(
+        new Error("setConversionOptions: numbers must be \"double\" or \"integer\".")
+      );
+    });
+
+    it("stores integral numbers as GemFire integers in integer mode", function() {
+      cache.setConversionOptions({ numbers: "integer" });
+      const value = { count: 5, total: Math.pow(2, 40), ratio: 0.5, negativeZero: -0, nested: [7, 7.5] };
+
+      region.putSync(1, value);
+
+      const result = region.getSync(1);
+      expect(result).toEqual(value);
+      expect(1 / result.negativeZero).toEqual(-Infinity);
+    });
+
+    it("writes each numeric PDX field with one type, whatever its value", function() {
+      cache.setConversionOptions({ numbers: "integer" });
+      const before = gemfire.conversionStats().pdxPlanCacheSize;
+
+      region.putSync("price1", { price: 10 });
+      region.putSync("price2", { price: 10.5 });
+      region.putSync("price3", { price: Math.pow(2, 31) });
+
+      expect(gemfire.conversionStats().pdxPlanCacheSize - before).toBeLessThan(2);
+      expect(region.getSync("price1")).toEqual({ price: 10 });
+      expect(region.getSync("price2")).toEqual({ price: 10.5 });
+      expect(region.getSync("price3")).toEqual({ price: Math.pow(2, 31) });
+    });
+
+    it("writes the fields named in longFields as PDX longs", function() {
+      cache.setConversionOptions({ numbers: "integer", longFields: ["id"] });
+      expect(cache.getConversionOptions().longFields).toEqual(["id"]);
+
+      region.putSync("order", { id: Math.pow(2, 40), total: 12.5 });
+      expect(region.getSync("order")).toEqual({ id: Math.pow(2, 40), total: 12.5 });
+
+      expect(function() { region.putSync("order", { id: 1.5 }); }).toThrow(
+        new Error("Unable to serialize to GemFire; long field is not a safe integer: id")
+      );
+      expect(function() { cache.setConversionOptions({ longFields: "id" }); }).toThrow(
+        new Error("setConversionOptions: longFields must be an array of field names.")
+      );
+    });
+
+    it("uses integer keys in integer mode, which do not match double keys", function() {
+      cache.setConversionOptions({ numbers: "integer" });
+      region.putSync(42, "integer key");
+
+      cache.setConversionOptions({ numbers: "double" });
+      expect(region.getSync(42)).toBeNull();
+
+      cache.setConversionOptions({ numbers: "integer" });
+      expect(region.getSync(42)).toEqual("integer key");
+    });
+
+    it("rejects invalid dictionary options", function() {
+      expect(function() { cache.setConversionOptions({ dictionaryKeyCount: -1 }); }).toThrow(
+        new Error("setConversionOptions: dictionaryKeyCount must be a non-negative integer.")
+      );
+      expect(function() { cache.setConversionOptions({ dictionaryIntegerKeys: "yes" }); }).toThrow(
+        new Error("setConversionOptions: dictionaryIntegerKeys must be a boolean.")
+      );
+      expect(function() { cache.setConversionOptions({ dictionaryType: "array" }); }).toThrow(
+        new Error("setConversionOptions: dictionaryType must be \"object\" or \"map\".")
+      );
+    });
+
+    it("stores Maps as GemFire hash maps and reads them back as Maps in map mode", function() {
+      cache.setConversionOptions({ dictionaryType: "map" });
+      const scores = new Map([[1, "one"], ["two", { nested: true }]]);
+
+      region.putSync("map", { scores: scores });
+
+      const value = region.getSync("map");
+      expect(value.scores instanceof Map).toBeTruthy();
+      expect(value.scores.get(1)).toEqual("one");
+      expect(value.scores.get("two")).toEqual({ nested: true });
+    });
+
+    it("reads GemFire hash maps back as plain objects by default", function() {
+      region.putSync("map", new Map([["foo", "bar"]]));
+
+      expect(region.getSync("map")).toEqual({ foo: "bar" });
+    });
+
+    it("throws when a Map key cannot be a GemFire key", function() {
+      expect(function() { region.putSync("map", new Map([[[], "array key"]])); }).toThrow(
+        new Error("Unable to serialize to GemFire; Map keys must be valid GemFire keys.")
+      );
+    });
+
+    it("stores objects with many keys or integer keys as dictionaries instead of PDX", function(done) {
+      cache.setConversionOptions({ dictionaryKeyCount: 3, dictionaryIntegerKeys: true, dictionaryType: "map" });
+      const wide = { a: 1, b: 2, c: 3 };
+      const byId = { 17: "seventeen", 42: "forty-two" };
+
+      region.putSync("wide", wide);
+      region.putSync("byId", byId);
+      region.putSync("narrow", { a: 1, b: 2 });
+
+      expect(region.getSync("wide") instanceof Map).toBeTruthy();
+      expect(region.getSync("byId").get("42")).toEqual("forty-two");
+      expect(region.getSync("narrow")).toEqual({ a: 1, b: 2 });
+
+      region.getAll(["wide", "byId"], function(error, values) {
+        expect(error).toBeFalsy();
+        expect(values.wide.get("c")).toEqual(3);
+        expect(values.byId.get("17")).toEqual("seventeen");
+        done();
+      });
+    });
+
+    (hasBigInt ? it : xit)("stores BigInts as 64 bit integers and reads them back as BigInts", function() {
+      const id = BigInt("9007199254740993");
+      cache.setConversionOptions({ int64: "bigint" });
+
+      region.putSync("bigint", { id: id, ids: new BigInt64Array([id, BigInt(-1)]) });
+
+      const value = region.getSync("bigint");
+      expect(typeof value.id).toEqual("bigint");
+      expect(value.id === id).toBeTruthy();
+      expect(value.ids instanceof BigInt64Array).toBeTruthy();
+      expect(value.ids[0] === id).toBeTruthy();
+    });
+
+    (hasBigInt ? it : xit)("rate-limits warnings about unsafe integers in number mode", function() {
+      region.putSync("first", BigInt("9007199254740993"));
+      region.putSync("second", BigInt("9007199254740995"));
+
+      // Setting the options resets the limiter, so an earlier spec's warning cannot hide this one.
+      cache.setConversionOptions({ int64: "number" });
+      spyOn(console, "warn");
+
+      expect(region.getSync("first")).toEqual(9007199254740992);
+      region.getSync("second");
+
+      expect(console.warn.calls.count()).toEqual(1);
+      expect(console.warn.calls.argsFor(0)[0]).toMatch(/greater than Number.MAX_SAFE_INTEGER/);
+    });
+
+    (hasBigInt ? it : xit)("throws when a BigInt does not fit in 64 bits", function() {
+      expect(function() { region.putSync("tooBig", BigInt("18446744073709551616")); }).toThrow(
+        new Error("Unable to serialize to GemFire; BigInt values must fit in a signed 64 bit integer.")
+      );
+    });
+  });
+
   describe(".executeFunction", function() {
     const expectFunctionsToThrowExceptionsCorrectly = false;
     itExecutesFunctions(
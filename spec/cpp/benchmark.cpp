@@ -0,0 +1,318 @@
+#include <v8.h>
+#include <nan.h>
+#include <uv.h>
+#include <geode/GeodeCppCache.hpp>
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "../../src/conversions.hpp"
+#include "../../src/mpsc_queue.hpp"
+
+using namespace v8;
+using namespace apache::geode::client;
+using namespace node_gemfire;
+
+// The conversion layer is compiled into this module, which is linked with -Bsymbolic, so these
+// count every allocation made by node-gemfire code. Allocations made inside the GemFire library
+// and V8 are not included; V8 heap usage is tracked separately through GC callbacks.
+static std::atomic<uint64_t> allocationCount(0);
+
+void * operator new(size_t size) {
+  allocationCount++;
+  void * pointer = malloc(size > 0 ? size : 1);
+  if (pointer == NULL) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void * operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void * pointer) noexcept {
+  free(pointer);
+}
+
+void operator delete[](void * pointer) noexcept {
+  free(pointer);
+}
+
+static size_t heapUsedBeforeGc = 0;
+static uint64_t collectedBytes = 0;
+
+static size_t usedHeapSize() {
+  HeapStatistics heapStatistics;
+  Isolate::GetCurrent()->GetHeapStatistics(&heapStatistics);
+  return heapStatistics.used_heap_size();
+}
+
+static NAN_GC_CALLBACK(beforeGc) {
+  heapUsedBeforeGc = usedHeapSize();
+}
+
+static NAN_GC_CALLBACK(afterGc) {
+  size_t heapUsedAfterGc = usedHeapSize();
+  if (heapUsedBeforeGc > heapUsedAfterGc) {
+    collectedBytes += heapUsedBeforeGc - heapUsedAfterGc;
+  }
+}
+
+static CachePtr benchmarkCache() {
+  static CachePtr cachePtr;
+  if (cachePtr == NULLPTR) {
+    CacheFactoryPtr cacheFactoryPtr(CacheFactory::createCacheFactory());
+    cacheFactoryPtr->setPdxReadSerialized(true);
+    cachePtr = cacheFactoryPtr->create();
+  }
+  return cachePtr;
+}
+
+static RegionPtr benchmarkRegion() {
+  static RegionPtr regionPtr;
+  if (regionPtr == NULLPTR) {
+    regionPtr = benchmarkCache()->createRegionFactory(LOCAL)->create("benchmark");
+  }
+  return regionPtr;
+}
+
+struct Measurement {
+  double nanosecondsPerOperation;
+  double allocationsPerOperation;
+  double v8BytesPerOperation;
+};
+
+template<typename TOperation>
+static Measurement measure(unsigned int iterations, TOperation operation) {
+  for (unsigned int i = 0; i < iterations / 10 + 1; i++) {
+    Nan::HandleScope scope;
+    operation();
+  }
+
+  uint64_t startAllocations = allocationCount;
+  uint64_t startCollected = collectedBytes;
+  size_t startHeapUsed = usedHeapSize();
+  uint64_t start = uv_hrtime();
+
+  for (unsigned int i = 0; i < iterations; i++) {
+    Nan::HandleScope scope;
+    operation();
+  }
+
+  uint64_t elapsed = uv_hrtime() - start;
+  double v8Bytes = static_cast<double>(usedHeapSize()) - startHeapUsed + (collectedBytes - startCollected);
+
+  Measurement measurement;
+  measurement.nanosecondsPerOperation = static_cast<double>(elapsed) / iterations;
+  measurement.allocationsPerOperation = static_cast<double>(allocationCount - startAllocations) / iterations;
+  measurement.v8BytesPerOperation = v8Bytes / iterations;
+  return measurement;
+}
+
+static Measurement measureOperation(const std::string & operation, const Local<Value> & value,
+                                    unsigned int iterations) {
+  CachePtr cachePtr(benchmarkCache());
+
+  if (operation == "getClassName") {
+    Local<Object> v8Object(value->ToObject());
+    return measure(iterations, [&]() { getClassName(v8Object); });
+  } else if (operation == "gemfireValue") {
+    return measure(iterations, [&]() { gemfireValue(value, cachePtr); });
+  } else if (operation == "gemfireHashMap") {
+    Local<Object> v8Object(value->ToObject());
+    return measure(iterations, [&]() { gemfireHashMap(v8Object, cachePtr); });
+  } else if (operation == "v8Value") {
+    // Read the value back through a LOCAL region so that v8Value sees what region.get() would.
+    RegionPtr regionPtr(benchmarkRegion());
+    regionPtr->put("benchmark", gemfireValue(value, cachePtr));
+    CacheablePtr cacheablePtr(regionPtr->get("benchmark"));
+    return measure(iterations, [&]() { v8Value(cacheablePtr); });
+  } else if (operation == "wstringFromV8String") {
+    Local<String> v8String(value->ToString());
+    return measure(iterations, [&]() { wstringFromV8String(v8String); });
+  }
+
+  std::string errorMessage("Unknown benchmark operation: ");
+  errorMessage.append(operation);
+  Nan::ThrowError(errorMessage.c_str());
+  return Measurement();
+}
+
+NAN_METHOD(Measure) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 3 || !info[0]->IsString() || !info[2]->IsNumber()) {
+    Nan::ThrowError("You must pass an operation name, a value and an iteration count to measure().");
+    return;
+  }
+
+  std::string operation(*Nan::Utf8String(info[0]));
+  unsigned int iterations = Nan::To<uint32_t>(info[2]).FromJust();
+
+  Measurement measurement;
+  try {
+    measurement = measureOperation(operation, info[1], iterations > 0 ? iterations : 1);
+  } catch (const apache::geode::client::Exception & exception) {
+    Nan::ThrowError(exception.getMessage());
+    return;
+  }
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("nsPerOp").ToLocalChecked(),
+      Nan::New(measurement.nanosecondsPerOperation));
+  Nan::Set(returnValue, Nan::New("allocationsPerOp").ToLocalChecked(),
+      Nan::New(measurement.allocationsPerOperation));
+  Nan::Set(returnValue, Nan::New("v8BytesPerOp").ToLocalChecked(),
+      Nan::New(measurement.v8BytesPerOperation));
+  info.GetReturnValue().Set(returnValue);
+}
+
+// Producer threads hand items to the measuring thread, which drains them as the event loop drains
+// EventStream and ResultStream: either through MpscQueue, or through a vector guarded by a mutex
+// and copied out, as those streams did before.
+struct HandOffItem {
+  explicit HandOffItem(uint64_t value) : value(value), next(NULL) {}
+  uint64_t value;
+  HandOffItem * next;
+};
+
+class MutexHandOff {
+ public:
+  MutexHandOff() { uv_mutex_init(&mutex); }
+  ~MutexHandOff() { uv_mutex_destroy(&mutex); }
+
+  void push(HandOffItem * item) {
+    uv_mutex_lock(&mutex);
+    items.push_back(item);
+    uv_mutex_unlock(&mutex);
+  }
+
+  size_t drain() {
+    uv_mutex_lock(&mutex);
+    std::vector<HandOffItem *> taken(items);
+    items.clear();
+    uv_mutex_unlock(&mutex);
+
+    for (std::vector<HandOffItem *>::iterator iterator(taken.begin()); iterator != taken.end(); ++iterator) {
+      delete *iterator;
+    }
+    return taken.size();
+  }
+
+ private:
+  uv_mutex_t mutex;
+  std::vector<HandOffItem *> items;
+};
+
+class MpscHandOff {
+ public:
+  void push(HandOffItem * item) {
+    queue.push(item);
+  }
+
+  size_t drain() {
+    size_t count;
+    HandOffItem * item(queue.drain(count));
+    while (item != NULL) {
+      HandOffItem * next(item->next);
+      delete item;
+      item = next;
+    }
+    return count;
+  }
+
+ private:
+  MpscQueue<HandOffItem> queue;
+};
+
+template<typename THandOff>
+struct HandOffProducer {
+  THandOff * handOff;
+  unsigned int items;
+};
+
+template<typename THandOff>
+static void produce(void * data) {
+  HandOffProducer<THandOff> * producer = static_cast<HandOffProducer<THandOff> *>(data);
+  for (unsigned int i = 0; i < producer->items; i++) {
+    producer->handOff->push(new HandOffItem(i));
+  }
+}
+
+template<typename THandOff>
+static Measurement measureHandOff(unsigned int producers, unsigned int items) {
+  THandOff handOff;
+  HandOffProducer<THandOff> producer = { &handOff, items };
+  std::vector<uv_thread_t> threads(producers);
+
+  uint64_t startAllocations = allocationCount;
+  uint64_t start = uv_hrtime();
+
+  for (unsigned int i = 0; i < producers; i++) {
+    uv_thread_create(&threads[i], produce<THandOff>, &producer);
+  }
+
+  uint64_t total = static_cast<uint64_t>(producers) * items;
+  uint64_t received = 0;
+  while (received < total) {
+    received += handOff.drain();
+  }
+
+  for (unsigned int i = 0; i < producers; i++) {
+    uv_thread_join(&threads[i]);
+  }
+
+  uint64_t elapsed = uv_hrtime() - start;
+
+  Measurement measurement;
+  measurement.nanosecondsPerOperation = static_cast<double>(elapsed) / total;
+  measurement.allocationsPerOperation = static_cast<double>(allocationCount - startAllocations) / total;
+  measurement.v8BytesPerOperation = 0;
+  return measurement;
+}
+
+NAN_METHOD(MeasureHandOff) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 3 || !info[0]->IsString() || !info[1]->IsNumber() || !info[2]->IsNumber()) {
+    Nan::ThrowError("You must pass a queue name, a producer count and an item count to measureHandOff().");
+    return;
+  }
+
+  std::string queue(*Nan::Utf8String(info[0]));
+  unsigned int producers = std::max(Nan::To<uint32_t>(info[1]).FromJust(), 1u);
+  unsigned int items = std::max(Nan::To<uint32_t>(info[2]).FromJust(), 1u);
+
+  Measurement measurement;
+  if (queue == "mutex") {
+    measurement = measureHandOff<MutexHandOff>(producers, items);
+  } else if (queue == "mpsc") {
+    measurement = measureHandOff<MpscHandOff>(producers, items);
+  } else {
+    std::string errorMessage("Unknown hand-off queue: ");
+    errorMessage.append(queue);
+    Nan::ThrowError(errorMessage.c_str());
+    return;
+  }
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("nsPerOp").ToLocalChecked(),
+      Nan::New(measurement.nanosecondsPerOperation));
+  Nan::Set(returnValue, Nan::New("allocationsPerOp").ToLocalChecked(),
+      Nan::New(measurement.allocationsPerOperation));
+  Nan::Set(returnValue, Nan::New("v8BytesPerOp").ToLocalChecked(),
+      Nan::New(measurement.v8BytesPerOperation));
+  info.GetReturnValue().Set(returnValue);
+}
+
+static void Initialize(Local<Object> exports) {
+  Nan::AddGCPrologueCallback(beforeGc);
+  Nan::AddGCEpilogueCallback(afterGc);
+  Nan::SetMethod(exports, "measure", Measure);
+  Nan::SetMethod(exports, "measureHandOff", MeasureHandOff);
+}
+
+NODE_MODULE(benchmark, Initialize)
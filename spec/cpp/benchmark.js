@@ -0,0 +1,76 @@
+#!/usr/bin/env node
+
+// Runs the conversion and hand-off microbenchmarks in spec/cpp/benchmark.cpp. Build them with
+// `node-pre-gyp build --build_benchmarks=true` (or `grunt benchmark`); no server is needed.
+//
+// Usage: spec/cpp/benchmark.js [iterations]
+
+const _ = require("lodash");
+const fs = require("fs");
+const path = require("path");
+
+const benchmarkPath = _.find([
+  path.join(__dirname, "../../build/Release/benchmark.node"),
+  path.join(__dirname, "../../build/Debug/benchmark.node")
+], fs.existsSync);
+
+if (!benchmarkPath) {
+  console.error("benchmark.node not found; build it with `node-pre-gyp build --build_benchmarks=true`.");
+  process.exit(1);
+}
+
+const benchmark = require(benchmarkPath);
+const iterations = parseInt(process.argv[2] || "1000", 10);
+
+function deepObject(depth) {
+  return depth === 0 ? { leaf: "value" } : { depth: depth, child: deepObject(depth - 1) };
+}
+
+const objects = {
+  stressTest: { values: require("../fixtures/stress_test.json") },
+  wide: _.zipObject(_.times(500, function(i) { return "field" + i; }), _.times(500)),
+  deep: deepObject(32),
+  strings: _.zipObject(
+    _.times(100, function(i) { return "string" + i; }),
+    _.times(100, function(i) { return i % 2 ? _.repeat("ascii text ", 20) : _.repeat("wíde téxt 中", 20); })
+  )
+};
+
+const strings = {
+  ascii: _.repeat("ascii text ", 1000),
+  wide: _.repeat("wíde téxt 中", 1000)
+};
+
+function report(label, operation, value) {
+  const result = benchmark.measure(operation, value, iterations);
+  console.log(
+    _.padEnd(label, 36) +
+    _.padStart(result.nsPerOp.toFixed(0), 12) + " ns/op" +
+    _.padStart(result.allocationsPerOp.toFixed(1), 10) + " allocs/op" +
+    _.padStart(result.v8BytesPerOp.toFixed(0), 12) + " V8 bytes/op"
+  );
+}
+
+_.each(objects, function(object, name) {
+  _.each(["getClassName", "gemfireValue", "gemfireHashMap", "v8Value"], function(operation) {
+    report(operation + " " + name, operation, object);
+  });
+});
+
+_.each(strings, function(string, name) {
+  report("wstringFromV8String " + name, "wstringFromV8String", string);
+});
+
+// Hand-off from GemFire threads to the event loop, as EventStream and ResultStream do it.
+_.each([1, 2, 4, 8], function(producers) {
+  _.each(["mutex", "mpsc"], function(queue) {
+    const result = benchmark.measureHandOff(queue, producers, iterations * 100);
+    console.log(
+      _.padEnd("hand-off " + queue + " " + producers + " producers", 36) +
+      _.padStart(result.nsPerOp.toFixed(0), 12) + " ns/op" +
+      _.padStart(result.allocationsPerOp.toFixed(1), 10) + " allocs/op"
+    );
+  });
+});
+
+process.exit(0);
@@ -102,6 +102,51 @@ TEST(getClassName, fieldNamesCanContainBackslash) {
                getClassName(secondObject).c_str());
 }
 
+TEST(getClassName, numbersAreUntypedByDefault) {
+  Local<Object> firstObject = Nan::New<Object>();
+  firstObject->Set(Nan::New("foo").ToLocalChecked(), Nan::New(1));
+
+  Local<Object> secondObject = Nan::New<Object>();
+  secondObject->Set(Nan::New("foo").ToLocalChecked(), Nan::New(1.5));
+
+  EXPECT_STREQ(getClassName(firstObject).c_str(),
+               getClassName(secondObject).c_str());
+}
+
+TEST(getClassName, numberKindMattersInIntegerMode) {
+  conversionOptions().numberMode = NUMBERS_AS_INTEGERS;
+
+  Local<Object> intObject = Nan::New<Object>();
+  intObject->Set(Nan::New("foo").ToLocalChecked(), Nan::New(1));
+
+  Local<Object> longObject = Nan::New<Object>();
+  longObject->Set(Nan::New("foo").ToLocalChecked(), Nan::New(4294967296.0));
+
+  Local<Object> doubleObject = Nan::New<Object>();
+  doubleObject->Set(Nan::New("foo").ToLocalChecked(), Nan::New(1.5));
+
+  EXPECT_STRNE(getClassName(intObject).c_str(), getClassName(longObject).c_str());
+  EXPECT_STRNE(getClassName(intObject).c_str(), getClassName(doubleObject).c_str());
+  EXPECT_STRNE(getClassName(longObject).c_str(), getClassName(doubleObject).c_str());
+
+  conversionOptions().numberMode = NUMBERS_AS_DOUBLES;
+}
+
+TEST(numberKind, integerMode) {
+  conversionOptions().numberMode = NUMBERS_AS_INTEGERS;
+
+  EXPECT_EQ(INT32_NUMBER, numberKind(Nan::New(-7)));
+  EXPECT_EQ(INT32_NUMBER, numberKind(Nan::New(2147483647.0)));
+  EXPECT_EQ(INT64_NUMBER, numberKind(Nan::New(2147483648.0)));
+  EXPECT_EQ(INT64_NUMBER, numberKind(Nan::New(9007199254740991.0)));
+  EXPECT_EQ(DOUBLE_NUMBER, numberKind(Nan::New(9007199254740992.0)));
+  EXPECT_EQ(DOUBLE_NUMBER, numberKind(Nan::New(0.5)));
+  EXPECT_EQ(DOUBLE_NUMBER, numberKind(Nan::New(-0.0)));
+
+  conversionOptions().numberMode = NUMBERS_AS_DOUBLES;
+  EXPECT_EQ(DOUBLE_NUMBER, numberKind(Nan::New(-7)));
+}
+
 TEST(getRegionShortcut, proxy) {
   EXPECT_EQ(apache::geode::client::PROXY, getRegionShortcut("PROXY"));
 }
@@ -1,3 +1,4 @@
+const _ = require("lodash");
 const gemfire = require("./support/gemfire.js");
 const cache = require("./support/factories.js").getCache();
 const expectExternalSuccess = require("./support/external_scripts.js").expectExternalSuccess;
@@ -16,6 +17,225 @@ describe("gemfire", function() {
     });
   });
 
+  describe(".conversionStats", function() {
+    it("counts a plan cache miss for a new object shape and hits for repeats", function(done) {
+      const region = cache.getRegion("exampleRegion");
+      const shape = { conversionStatsSpecField: "value" };
+      const before = gemfire.conversionStats();
+
+      region.putSync("first", shape);
+      region.putSync("second", { conversionStatsSpecField: "another value" });
+
+      const after = gemfire.conversionStats();
+      expect(after.pdxPlanCacheMisses - before.pdxPlanCacheMisses).toEqual(1);
+      expect(after.pdxPlanCacheHits - before.pdxPlanCacheHits).toEqual(1);
+      expect(after.pdxPlanCacheSize).toEqual(before.pdxPlanCacheSize + 1);
+      region.clear(done);
+    });
+
+    it("shares one shape between values read with the same PDX fields", function(done) {
+      const region = cache.getRegion("exampleRegion");
+      region.putSync("first", { shapeSpecA: 1, shapeSpecB: "one" });
+      region.putSync("second", { shapeSpecA: 2, shapeSpecB: "two" });
+      const before = gemfire.conversionStats();
+
+      const first = region.getSync("first");
+      region.get("second", function(error, second) {
+        expect(error).toBeFalsy();
+        expect(first).toEqual({ shapeSpecA: 1, shapeSpecB: "one" });
+        expect(second).toEqual({ shapeSpecA: 2, shapeSpecB: "two" });
+        expect(Object.keys(second)).toEqual(Object.keys(first));
+        expect(gemfire.conversionStats().pdxShapeCacheSize).toEqual(before.pdxShapeCacheSize + 1);
+        region.clear(done);
+      });
+    });
+  });
+
+  describe(".threadPoolStats", function() {
+    it("counts completed GemFire calls", function(done) {
+      const region = cache.getRegion("exampleRegion");
+      const before = gemfire.threadPoolStats();
+
+      region.put("threadPoolStats", "value", function(error) {
+        expect(error).toBeFalsy();
+        const after = gemfire.threadPoolStats();
+        expect(after.size).toEqual(before.size);
+        expect(after.threads).toBeGreaterThan(0);
+        expect(after.completedTasks).toBeGreaterThan(before.completedTasks);
+        expect(after.keyWaitingTasks).toEqual(0);
+        region.clear(done);
+      });
+    });
+
+    it("reports queue times per lane", function(done) {
+      const region = cache.getRegion("exampleRegion");
+      const before = gemfire.threadPoolStats().lanes;
+
+      region.get("threadPoolStats", function(error) {
+        expect(error).toBeFalsy();
+        region.keys(function(error) {
+          expect(error).toBeFalsy();
+          const after = gemfire.threadPoolStats().lanes;
+          expect(after.point.completedTasks).toBeGreaterThan(before.point.completedTasks);
+          expect(after.bulk.completedTasks).toBeGreaterThan(before.bulk.completedTasks);
+          expect(after.point.maxQueueTimeMs).not.toBeLessThan(after.point.averageQueueTimeMs);
+          done();
+        });
+      });
+    });
+
+    it("queues a call in the lane given by the lane option", function(done) {
+      const region = cache.getRegion("exampleRegion");
+      const before = gemfire.threadPoolStats().lanes;
+
+      region.get("threadPoolStats", { lane: "bulk" }, function(error) {
+        expect(error).toBeFalsy();
+        const after = gemfire.threadPoolStats().lanes;
+        expect(after.bulk.completedTasks).toEqual(before.bulk.completedTasks + 1);
+        expect(after.point.completedTasks).toEqual(before.point.completedTasks);
+        done();
+      });
+    });
+
+    it("rejects unknown lanes", function() {
+      const region = cache.getRegion("exampleRegion");
+      expect(function() { region.get("foo", { lane: "fast" }, function() {}); }).toThrow(
+        new Error("lane must be \"point\" or \"bulk\".")
+      );
+    });
+  });
+
+  describe(".setThreadPoolSize", function() {
+    afterEach(function() {
+      gemfire.setThreadPoolSize(4);
+    });
+
+    it("changes the pool size", function() {
+      gemfire.setThreadPoolSize(8);
+      expect(gemfire.threadPoolStats().size).toEqual(8);
+    });
+
+    it("reserves threads for point operations", function() {
+      gemfire.setThreadPoolSize(8, { reservedPointThreads: 2 });
+      expect(gemfire.threadPoolStats().reservedPointThreads).toEqual(2);
+
+      expect(function() { gemfire.setThreadPoolSize(2, { reservedPointThreads: 2 }); }).toThrow(
+        new Error("setThreadPoolSize: reservedPointThreads must be an integer less than size.")
+      );
+    });
+
+    it("requires a size between 1 and 1024", function() {
+      expect(function() { gemfire.setThreadPoolSize(0); }).toThrow(
+        new Error("setThreadPoolSize: size must be an integer between 1 and 1024.")
+      );
+    });
+  });
+
+  describe(".setEventQueueCapacity", function() {
+    var region;
+
+    beforeEach(function(done) {
+      region = cache.getRegion("exampleRegion");
+      region.clear(done);
+    });
+
+    afterEach(function() {
+      region.removeAllListeners();
+      gemfire.setEventQueueCapacity(0);
+    });
+
+    it("drops events that arrive while the queue is full", function(done) {
+      gemfire.setEventQueueCapacity(2, { overflow: "dropNewest" });
+
+      const keys = [];
+      region.on("create", function(event) { keys.push(event.key); });
+
+      const before = gemfire.eventStats();
+      _.times(5, function(i) { region.putSync("eventQueue" + i, i); });
+
+      _.delay(function() {
+        const after = gemfire.eventStats();
+        expect(keys).toEqual(["eventQueue0", "eventQueue1"]);
+        expect(after.droppedEvents - before.droppedEvents).toEqual(3);
+        expect(after.highWaterMark).toBeGreaterThan(1);
+        expect(after.capacity).toEqual(2);
+        expect(after.overflow).toEqual("dropNewest");
+        done();
+      }, 100);
+    });
+
+    it("keeps the newest events when dropping the oldest", function(done) {
+      gemfire.setEventQueueCapacity(2, { overflow: "dropOldest" });
+
+      const keys = [];
+      region.on("create", function(event) { keys.push(event.key); });
+
+      _.times(5, function(i) { region.putSync("eventQueue" + i, i); });
+
+      _.delay(function() {
+        expect(keys).toEqual(["eventQueue3", "eventQueue4"]);
+        done();
+      }, 100);
+    });
+
+    it("queues events raised on the event loop past the capacity when blocking", function(done) {
+      gemfire.setEventQueueCapacity(2);
+
+      const keys = [];
+      region.on("create", function(event) { keys.push(event.key); });
+
+      _.times(5, function(i) { region.putSync("eventQueue" + i, i); });
+
+      _.delay(function() {
+        expect(keys.length).toEqual(5);
+        expect(gemfire.eventStats().overflow).toEqual("block");
+        done();
+      }, 100);
+    });
+
+    it("requires a capacity and a known overflow policy", function() {
+      expect(function() { gemfire.setEventQueueCapacity(-1); }).toThrow(
+        new Error("setEventQueueCapacity: capacity must be a non-negative integer.")
+      );
+      expect(function() { gemfire.setEventQueueCapacity(10, { overflow: "wait" }); }).toThrow(
+        new Error("setEventQueueCapacity: overflow must be \"block\", \"dropOldest\", \"dropNewest\" or \"conflate\".")
+      );
+    });
+  });
+
+  describe(".setResultQueueCapacity", function() {
+    afterEach(function() {
+      gemfire.setResultQueueCapacity(10000);
+    });
+
+    it("delivers every result through a smaller queue and reports it", function(done) {
+      gemfire.setResultQueueCapacity(1);
+
+      const results = [];
+      cache.executeFunction("io.pivotal.node_gemfire.Passthrough", { arguments: [1,2], poolName: "myPool" })
+        .on("data", function(data) { results.push(data); })
+        .on("end", function() {
+          const stats = gemfire.resultQueueStats();
+          expect(results).toEqual([[1,2]]);
+          expect(stats.pendingResults).toEqual(0);
+          expect(stats.highWaterMark).toBeGreaterThan(0);
+          expect(stats.blockedResults).toEqual(jasmine.any(Number));
+          expect(stats.capacity).toEqual(1);
+          done();
+        });
+    });
+
+    it("requires a non-negative integer capacity", function() {
+      expect(function() { gemfire.setResultQueueCapacity(-1); }).toThrow(
+        new Error("setResultQueueCapacity: capacity must be a non-negative integer.")
+      );
+      expect(function() { gemfire.setResultQueueCapacity("10"); }).toThrow(
+        new Error("setResultQueueCapacity: capacity must be a non-negative integer.")
+      );
+      expect(gemfire.resultQueueStats().capacity).toEqual(10000);
+    });
+  });
+
   describe(".connected", function() {
     it("returns true if the client is connected to the GemFire system", function() {
       expect(gemfire.connected()).toBeTruthy();
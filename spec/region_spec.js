@@ -220,6 +220,272 @@ describe("gemfire.Region", function() {
 
   });
 
+  describe("local lookups", function() {
+    it("peek returns the locally cached value or null", function() {
+      region.putSync("foo", { bar: 1 });
+      expect(region.peek("foo")).toEqual({ bar: 1 });
+      expect(region.peek("missing")).toBeNull();
+    });
+
+    it("containsKey and containsValueForKey check the local cache", function() {
+      region.putSync("foo", "bar");
+      expect(region.containsKey("foo")).toBe(true);
+      expect(region.containsValueForKey("foo")).toBe(true);
+      expect(region.containsKey("missing")).toBe(false);
+      expect(region.containsValueForKey("missing")).toBe(false);
+    });
+
+    it("size returns the number of local entries", function() {
+      region.putAllSync({ foo: 1, bar: 2 });
+      expect(region.size()).toEqual(2);
+    });
+
+    it("throws when passed no key or an invalid key", function() {
+      expect(function() { region.peek(); }).toThrow(new Error("You must pass a key to peek()."));
+      expect(function() { region.containsKey(null); }).toThrow(new Error("Invalid GemFire key."));
+    });
+  });
+
+  describe(".containsKeyOnServer", function() {
+    it("passes whether the server has an entry for the key", function(done) {
+      region.put("foo", "bar", function(error) {
+        expect(error).not.toBeError();
+        region.containsKeyOnServer("foo", function(error, containsKey) {
+          expect(error).not.toBeError();
+          expect(containsKey).toBe(true);
+          region.containsKeyOnServer("missing", function(error, containsKey) {
+            expect(containsKey).toBe(false);
+            done();
+          });
+        });
+      });
+    });
+
+    it("requires a callback", function() {
+      expect(function() { region.containsKeyOnServer("foo"); })
+        .toThrow(new Error("You must pass a function as the callback to containsKeyOnServer()."));
+    });
+  });
+
+  describe(".setKeyOrdering", function() {
+    afterEach(function() {
+      region.setKeyOrdering(false);
+    });
+
+    it("requires a boolean", function() {
+      expect(function() { region.setKeyOrdering("yes"); }).toThrow(
+        new Error("You must pass a boolean to setKeyOrdering().")
+      );
+    });
+
+    it("stores puts to the same key in the order they were issued", function(done) {
+      region.setKeyOrdering(true);
+
+      const completed = [];
+      _.times(50, function(i) {
+        region.put("ordered", i, function(error) {
+          expect(error).not.toBeError();
+          completed.push(i);
+          if (completed.length === 50) {
+            expect(completed).toEqual(_.range(50));
+            region.get("ordered", function(error, value) {
+              expect(value).toEqual(49);
+              done();
+            });
+          }
+        });
+      });
+    });
+
+    it("orders a remove after the put before it", function(done) {
+      region.setKeyOrdering(true);
+
+      region.put("ordered", "value");
+      region.remove("ordered", function(error) {
+        expect(error).not.toBeError();
+        region.get("ordered", function(error, value) {
+          expect(value).toBe(null);
+          done();
+        });
+      });
+    });
+  });
+
+  describe(".setGetBatching", function() {
+    afterEach(function() {
+      region.setGetBatching(false);
+    });
+
+    it("requires an options object or false", function() {
+      expect(function() { region.setGetBatching(); }).toThrow(
+        new Error("You must pass an options object or false to setGetBatching().")
+      );
+      expect(function() { region.setGetBatching({ maxBatchSize: 1.5 }); }).toThrow(
+        new Error("setGetBatching: maxBatchSize must be a positive integer.")
+      );
+    });
+
+    it("passes each caller its own value, including duplicates and misses", function(done) {
+      region.putAllSync({ foo: { value: "bar" }, baz: "qux" });
+      region.setGetBatching({});
+
+      async.parallel([
+        function(next) { region.get("foo", next); },
+        function(next) { region.get("foo", next); },
+        function(next) { region.get("baz", next); },
+        function(next) { region.get("missing", next); }
+      ], function(error, results) {
+        expect(error).not.toBeError();
+        expect(results).toEqual([{ value: "bar" }, { value: "bar" }, "qux", null]);
+        expect(results[0]).not.toBe(results[1]);
+        done();
+      });
+    });
+
+    it("gives each caller of a duplicate key its own Buffer", function(done) {
+      const proxyRegion = cache.getRegion("exampleProxyRegion");
+      proxyRegion.putSync("batchedBuffer", Buffer.from([1, 2, 3]));
+      proxyRegion.setGetBatching({});
+
+      async.parallel([
+        function(next) { proxyRegion.get("batchedBuffer", next); },
+        function(next) { proxyRegion.get("batchedBuffer", next); },
+        function(next) { proxyRegion.get("batchedBuffer", next); }
+      ], function(error, results) {
+        proxyRegion.setGetBatching(false);
+        expect(error).not.toBeError();
+        results[0][0] = 9;
+        results[1][1] = 9;
+        expect(results[0]).toEqual(Buffer.from([9, 2, 3]));
+        expect(results[1]).toEqual(Buffer.from([1, 9, 3]));
+        expect(results[2]).toEqual(Buffer.from([1, 2, 3]));
+        proxyRegion.remove("batchedBuffer", done);
+      });
+    });
+
+    it("stores the fetched values in the local cache like an unbatched get", function(done) {
+      region.setGetBatching({});
+
+      region.executeFunction("io.pivotal.node_gemfire.Put", ["serverOnly", "value"])
+        .on("error", function(error) { throw(error); })
+        .on("end", function() {
+          expect(region.peek("serverOnly")).toBeNull();
+
+          region.get("serverOnly", function(error, value) {
+            expect(error).not.toBeError();
+            expect(value).toEqual("value");
+            expect(region.peek("serverOnly")).toEqual("value");
+            done();
+          });
+        });
+    });
+
+    it("still reports invalid keys to the get's own callback", function(done) {
+      region.setGetBatching({});
+
+      region.get([], function(error, value) {
+        expect(error).toBeError("InvalidKeyError", "Invalid GemFire key.");
+        expect(value).toBeUndefined();
+        done();
+      });
+    });
+  });
+
+  describe(".setPutCoalescing", function() {
+    afterEach(function() {
+      region.setPutCoalescing(false);
+    });
+
+    it("requires an options object or false", function() {
+      expect(function() { region.setPutCoalescing(); }).toThrow(
+        new Error("You must pass an options object or false to setPutCoalescing().")
+      );
+      expect(function() { region.setPutCoalescing({ windowMicros: -1 }); }).toThrow(
+        new Error("setPutCoalescing: windowMicros must be a non-negative number.")
+      );
+      expect(function() { region.setPutCoalescing({ maxBatchSize: 0 }); }).toThrow(
+        new Error("setPutCoalescing: maxBatchSize must be a positive integer.")
+      );
+    });
+
+    it("calls back once per put and stores every entry", function(done) {
+      region.setPutCoalescing({});
+
+      async.parallel(_.times(10, function(i) {
+        return function(next) { region.put("key" + i, "value" + i, next); };
+      }), function(error) {
+        expect(error).not.toBeError();
+        expect(region.getAllSync(["key0", "key9"])).toEqual({ key0: "value0", key9: "value9" });
+        done();
+      });
+    });
+
+    it("keeps the last value put to a key within a batch", function(done) {
+      region.setPutCoalescing({ windowMicros: 1000 });
+
+      region.put("foo", "first");
+      region.put("foo", "second", function(error) {
+        expect(error).not.toBeError();
+        expect(region.getSync("foo")).toEqual("second");
+        done();
+      });
+    });
+
+    it("sends the batch once it reaches maxBatchSize", function(done) {
+      region.setPutCoalescing({ windowMicros: 60 * 1000 * 1000, maxBatchSize: 2 });
+
+      region.put("foo", "bar");
+      region.put("baz", "qux", function(error) {
+        expect(error).not.toBeError();
+        expect(region.getSync("foo")).toEqual("bar");
+        done();
+      });
+    });
+
+    it("sends the pending batch when coalescing is turned off", function(done) {
+      region.setPutCoalescing({ windowMicros: 60 * 1000 * 1000 });
+
+      region.put("foo", "bar", function(error) {
+        expect(error).not.toBeError();
+        done();
+      });
+      region.setPutCoalescing(false);
+    });
+
+    it("emits one error event for a failed batch of puts without callbacks", function(done) {
+      const regionName = "putCoalescingWithoutServerRegion";
+      const proxyRegion = cache.createRegion(regionName, {type: "PROXY", poolName: "myPool"});
+      const errorHandler = jasmine.createSpy("errorHandler");
+
+      proxyRegion.on("error", errorHandler);
+      proxyRegion.setPutCoalescing({});
+
+      proxyRegion.put("foo", "bar");
+      proxyRegion.put("baz", "qux");
+      proxyRegion.put("quux", "corge", function(error) {
+        expect(error).toBeError();
+
+        _.delay(function() {
+          expect(errorHandler.calls.count()).toEqual(1);
+          expect(errorHandler.calls.argsFor(0)[0]).toBeError();
+          proxyRegion.localDestroyRegion(function(error) {
+            expect(error).not.toBeError();
+            done();
+          });
+        }, 100);
+      });
+    });
+
+    it("still reports invalid values to the put's own callback", function(done) {
+      region.setPutCoalescing({});
+
+      region.put("foo", null, function(error) {
+        expect(error).toBeError("InvalidValueError", "Invalid GemFire value.");
+        done();
+      });
+    });
+  });
+
   describe(".putSync", function() {
     it("throws an error when no key is passed", function() {
       function putWithNoArgs() {
@@ -312,6 +578,7 @@ describe("gemfire.Region", function() {
     _.each([
       "",
       "foo",
+      "caf\u00e9 cr\u00e8me br\u00fbl\u00e9e",
       "\u0123\u4567\u89AB\uCDEF\uabcd\uef4A",
     ], function(string) {
       it("stores and retrieves strings like " + util.inspect(string), function(done) {
@@ -485,6 +752,73 @@ describe("gemfire.Region", function() {
       testRoundTrip(undefined, done);
     });
 
+    it("stores and retrieves Buffers", function(done) {
+      testRoundTrip(Buffer.from([0, 1, 2, 254, 255]), done);
+    });
+
+    it("stores and retrieves empty Buffers", function(done) {
+      testRoundTrip(Buffer.alloc(0), done);
+    });
+
+    it("stores Uint8Arrays as Buffers", function(done) {
+      region.put("foo", new Uint8Array([1, 2, 3]), function(error) {
+        expect(error).not.toBeError();
+        region.get("foo", function(error, value) {
+          expect(error).not.toBeError();
+          expect(Buffer.isBuffer(value)).toBeTruthy();
+          expect(value).toEqual(Buffer.from([1, 2, 3]));
+          done();
+        });
+      });
+    });
+
+    _.each([
+      new Int16Array([-32768, 0, 32767]),
+      new Int32Array([-2147483648, 0, 2147483647]),
+      new Float32Array([0.5, -1.25]),
+      new Float64Array([Math.PI, -0.0, Number.MAX_VALUE]),
+      new Uint16Array([0, 65535])
+    ], function(typedArray) {
+      it("stores and retrieves typed arrays like " + util.inspect(typedArray), function(done) {
+        testRoundTrip(typedArray, done);
+      });
+    });
+
+    it("reads back Uint32Arrays as 64 bit integers", function(done) {
+      region.put("foo", new Uint32Array([0, 4294967295]), function(error) {
+        expect(error).not.toBeError();
+        region.get("foo", function(error, value) {
+          expect(error).not.toBeError();
+          expect(value).toEqual([0, 4294967295]);
+          done();
+        });
+      });
+    });
+
+    it("does not change the cached entry when a Buffer read back is modified", function(done) {
+      region.putSync("foo", Buffer.from([1, 2, 3]));
+
+      region.get("foo", function(error, value) {
+        expect(error).not.toBeError();
+        value[0] = 9;
+        expect(region.getSync("foo")).toEqual(Buffer.from([1, 2, 3]));
+        expect(region.peek("foo")).toEqual(Buffer.from([1, 2, 3]));
+        done();
+      });
+    });
+
+    it("does not change the cached entry when a typed array read back is modified", function() {
+      region.putSync("foo", new Float64Array([1.5, 2.5]));
+
+      const value = region.getSync("foo");
+      value[0] = 0;
+      expect(region.getSync("foo")).toEqual(new Float64Array([1.5, 2.5]));
+    });
+
+    it("stores and retrieves objects containing Buffers", function(done) {
+      testRoundTrip({ payload: Buffer.from("protobuf bytes") }, done);
+    });
+
     it("stores and retrieves Date objects", function(done) {
       const date = new Date();
       testRoundTrip(date, done);
@@ -900,6 +1234,237 @@ describe("gemfire.Region", function() {
     });
   });
 
+  describe(".putIfAbsent", function() {
+    var localRegion;
+
+    beforeEach(function(done) {
+      localRegion = cache.getRegion("putIfAbsentLocalRegion") ||
+        cache.createRegion("putIfAbsentLocalRegion", { type: "LOCAL" });
+      localRegion.clear(done);
+    });
+
+    it("stores the value only when the key has no entry", function(done) {
+      async.series([
+        function(next) {
+          localRegion.putIfAbsent("foo", "bar", function(error, created) {
+            expect(error).not.toBeError();
+            expect(created).toBe(true);
+            next();
+          });
+        },
+        function(next) {
+          localRegion.putIfAbsent("foo", "baz", function(error, created) {
+            expect(error).not.toBeError();
+            expect(created).toBe(false);
+            next();
+          });
+        },
+        function(next) {
+          localRegion.get("foo", function(error, value) {
+            expect(value).toEqual("bar");
+            next();
+          });
+        },
+      ], done);
+    });
+
+    it("throws on regions backed by a server, where the check would not be atomic", function() {
+      const message = "putIfAbsent() is only supported on regions without a pool, such as LOCAL regions; " +
+        "the GemFire native client cannot check and store atomically on the server.";
+
+      expect(function() { region.putIfAbsent("foo", "bar", function() {}); }).toThrow(new Error(message));
+      expect(function() { cache.getRegion("exampleProxyRegion").putIfAbsent("foo", "bar"); })
+        .toThrow(new Error(message));
+      expect(region.getSync("foo")).toBeNull();
+    });
+
+    it("passes an error to the callback when passed an invalid key", function(done) {
+      localRegion.putIfAbsent(null, "bar", function(error) {
+        expect(error).toBeError("InvalidKeyError", "Invalid GemFire key.");
+        done();
+      });
+    });
+
+    it("requires a key and value", function() {
+      expect(function() { localRegion.putIfAbsent("foo"); })
+        .toThrow(new Error("You must pass a key and value to putIfAbsent()."));
+    });
+  });
+
+  describe(".putIfAbsentSync", function() {
+    var localRegion;
+
+    beforeEach(function(done) {
+      localRegion = cache.getRegion("putIfAbsentLocalRegion") ||
+        cache.createRegion("putIfAbsentLocalRegion", { type: "LOCAL" });
+      localRegion.clear(done);
+    });
+
+    it("returns whether the value was stored", function() {
+      expect(localRegion.putIfAbsentSync("foo", "bar")).toBe(true);
+      expect(localRegion.putIfAbsentSync("foo", "baz")).toBe(false);
+      expect(localRegion.getSync("foo")).toEqual("bar");
+    });
+
+    it("throws on regions backed by a server", function() {
+      expect(function() { region.putIfAbsentSync("foo", "bar"); }).toThrow(
+        new Error("putIfAbsentSync() is only supported on regions without a pool, such as LOCAL regions; " +
+          "the GemFire native client cannot check and store atomically on the server.")
+      );
+    });
+  });
+
+  describe(".removeIfEquals", function() {
+    it("removes the entry only when it has the given value", function(done) {
+      async.series([
+        function(next) { region.put("foo", { count: 1 }, next); },
+        function(next) {
+          region.removeIfEquals("foo", { count: 2 }, function(error, removed) {
+            expect(error).not.toBeError();
+            expect(removed).toBe(false);
+            next();
+          });
+        },
+        function(next) {
+          region.removeIfEquals("foo", { count: 1 }, function(error, removed) {
+            expect(error).not.toBeError();
+            expect(removed).toBe(true);
+            next();
+          });
+        },
+        function(next) {
+          region.get("foo", function(error, value) {
+            expect(value).toBe(null);
+            next();
+          });
+        },
+      ], done);
+    });
+
+    it("requires the callback to be a function", function() {
+      expect(function() { region.removeIfEquals("foo", "bar", "not a function"); })
+        .toThrow(new Error("You must pass a function as the callback to removeIfEquals()."));
+    });
+  });
+
+  describe(".removeIfEqualsSync", function() {
+    it("returns whether the entry was removed", function() {
+      region.putSync("foo", "bar");
+      expect(region.removeIfEqualsSync("foo", "baz")).toBe(false);
+      expect(region.removeIfEqualsSync("foo", "bar")).toBe(true);
+      expect(region.getSync("foo")).toBeNull();
+    });
+  });
+
+  describe(".removeAll", function() {
+    it("removes the entries at the given keys", function(done) {
+      async.series([
+        function(next) { region.putAll({ foo: 1, bar: 2, baz: 3 }, next); },
+        function(next) { region.removeAll(["foo", "bar", "missing"], next); },
+        function(next) {
+          region.getAll(["foo", "bar", "baz"], function(error, values) {
+            expect(error).not.toBeError();
+            expect(values).toEqual({ foo: null, bar: null, baz: 3 });
+            next();
+          });
+        },
+      ], done);
+    });
+
+    it("removes the valid keys and reports the invalid ones", function(done) {
+      region.putAll({ foo: 1, bar: 2 }, function(error) {
+        expect(error).not.toBeError();
+        region.removeAll(["foo", null, "bar"], function(error) {
+          expect(error).toBeError("InvalidKeyError", "Invalid GemFire key.");
+          expect(error.failedKeys).toEqual([null]);
+          expect(error.unknownKeys).toEqual([]);
+          region.getAll(["foo", "bar"], function(error, values) {
+            expect(values).toEqual({ foo: null, bar: null });
+            done();
+          });
+        });
+      });
+    });
+
+    it("returns the region for chaining", function() {
+      expect(region.removeAll([], function(){})).toEqual(region);
+    });
+
+    it("requires an array of keys", function() {
+      expect(function() { region.removeAll("foo"); })
+        .toThrow(new Error("You must pass an array of keys to removeAll()."));
+    });
+
+    it("requires the callback to be a function", function() {
+      expect(function() { region.removeAll([], "not a function"); })
+        .toThrow(new Error("You must pass a function as the callback to removeAll()."));
+    });
+
+    it("emits an event when an error occurs and there is no callback", function(done) {
+      region.on("error", function(error) {
+        expect(error).toBeError("InvalidKeyError", "Invalid GemFire key.");
+        done();
+      });
+      region.removeAll([null]);
+    });
+
+    it("reports the valid keys as unknown when the removeAll call fails", function(done) {
+      const regionName = "removeAllWithoutServerRegion";
+      const proxyRegion = cache.createRegion(regionName, {type: "PROXY", poolName: "myPool"});
+
+      proxyRegion.removeAll(["foo", null, "bar"], function(error) {
+        expect(error).toBeError();
+        expect(error.failedKeys).toEqual([null]);
+        expect(error.unknownKeys).toEqual(["foo", "bar"]);
+        proxyRegion.localDestroyRegion(function(error) {
+          expect(error).not.toBeError();
+          done();
+        });
+      });
+    });
+  });
+
+  describe(".removeAllSync", function() {
+    it("removes the entries at the given keys", function() {
+      region.putAllSync({ foo: 1, bar: 2 });
+      expect(region.removeAllSync(["foo"])).toEqual(region);
+      expect(region.getAllSync(["foo", "bar"])).toEqual({ foo: null, bar: 2 });
+    });
+
+    it("throws an error listing the invalid keys after removing the others", function() {
+      region.putAllSync({ foo: 1 });
+
+      var thrown;
+      try {
+        region.removeAllSync(["foo", []]);
+      } catch (error) {
+        thrown = error;
+      }
+
+      expect(thrown).toBeError("InvalidKeyError", "Invalid GemFire key.");
+      expect(thrown.failedKeys).toEqual([[]]);
+      expect(thrown.unknownKeys).toEqual([]);
+      expect(region.getSync("foo")).toBeNull();
+    });
+
+    it("reports the valid keys as unknown when the removeAll call fails", function() {
+      const regionName = "removeAllSyncWithoutServerRegion";
+      const proxyRegion = cache.createRegion(regionName, {type: "PROXY", poolName: "myPool"});
+
+      var thrown;
+      try {
+        proxyRegion.removeAllSync(["foo", []]);
+      } catch (error) {
+        thrown = error;
+      }
+
+      expect(thrown).toBeError();
+      expect(thrown.failedKeys).toEqual([[]]);
+      expect(thrown.unknownKeys).toEqual(["foo"]);
+      proxyRegion.localDestroyRegion();
+    });
+  });
+
   describe(".remove", function() {
     it("throws an error if no key is given", function() {
       function callNoArgs() {
@@ -1319,6 +1884,61 @@ describe("gemfire.Region", function() {
         done
       );
     });
+
+    describe("with a chunkSize", function() {
+      it("stores the entries in chunks and reports progress for each", function(done) {
+        const entries = _.zipObject(_.times(25, function(i) { return "key" + i; }), _.times(25));
+        const progress = jasmine.createSpy("progress");
+
+        region.putAll(entries, { chunkSize: 10, maxInFlight: 2, progress: progress }, function(error, summary) {
+          expect(error).not.toBeError();
+          expect(summary).toEqual({ totalEntries: 25, storedEntries: 25, failedChunks: 0 });
+          expect(progress.calls.count()).toEqual(3);
+          expect(_.sortBy(_.map(progress.calls.allArgs(), function(args) { return args[1].entries; }))).toEqual([5, 10, 10]);
+
+          region.getAll(["key0", "key24"], function(error, values) {
+            expect(error).not.toBeError();
+            expect(values).toEqual({ key0: 0, key24: 24 });
+            done();
+          });
+        });
+      });
+
+      it("stores the other chunks when one chunk fails", function(done) {
+        const progress = jasmine.createSpy("progress");
+
+        region.putAll({ foo: "bar", baz: null, qux: "quux" }, { chunkSize: 1, progress: progress }, function(error, summary) {
+          expect(error).toBeError("InvalidValueError", "Invalid GemFire value.");
+          expect(summary).toEqual({ totalEntries: 3, storedEntries: 2, failedChunks: 1 });
+          expect(_.filter(progress.calls.allArgs(), function(args) { return args[0]; }).length).toEqual(1);
+
+          region.get("qux", function(error, value) {
+            expect(value).toEqual("quux");
+            done();
+          });
+        });
+      });
+
+      it("passes a conversion error for a chunk to the callback instead of throwing", function(done) {
+        region.putAll({ foo: function() {} }, { chunkSize: 1 }, function(error, summary) {
+          expect(error).toEqual(new Error("Unable to serialize to GemFire; functions are not supported."));
+          expect(summary.failedChunks).toEqual(1);
+          done();
+        });
+      });
+
+      it("requires chunkSize and maxInFlight to be positive integers", function() {
+        expect(function() { region.putAll({}, { chunkSize: 0 }); })
+          .toThrow(new Error("putAll: chunkSize must be a positive integer."));
+        expect(function() { region.putAll({}, { chunkSize: 10, maxInFlight: 1.5 }); })
+          .toThrow(new Error("putAll: maxInFlight must be a positive integer."));
+      });
+
+      it("requires progress to be a function", function() {
+        expect(function() { region.putAll({}, { chunkSize: 10, progress: "nope" }); })
+          .toThrow(new Error("putAll: progress must be a function."));
+      });
+    });
   });
 
   describe(".putAllSync", function() {
@@ -1420,6 +2040,27 @@ describe("gemfire.Region", function() {
       ], done);
     });
 
+    it("decodes nested values the same way as getAllSync", function(done) {
+      const value = {
+        name: "ténānt中",
+        long: _.repeat("a", 2048),
+        nested: { list: [1, 2.5, true, null, "x"], when: new Date(0) },
+        bytes: Buffer.from([1, 2, 3])
+      };
+
+      async.series([
+        function(next) { region.put('nested', value, next); },
+        function(next) {
+          region.getAll(['nested'], function(error, response){
+            expect(error).not.toBeError();
+            expect(response).toEqual(region.getAllSync(['nested']));
+            expect(response.nested).toEqual(value);
+            next();
+          });
+        }
+      ], done);
+    });
+
     it("returns the region for chaining", function() {
       expect(region.getAll(['key'], function(){})).toEqual(region);
     });
@@ -1676,7 +2317,278 @@ describe("gemfire.Region", function() {
     });
   });
 
+  describe(".iterateEntries", function() {
+    function collect(iterator, callback) {
+      var chunks = [];
+      iterator.next(function handleChunk(error, chunk) {
+        if (error) { return callback(error); }
+        if (chunk === null) { return callback(null, chunks); }
+        chunks.push(chunk);
+        iterator.next(handleChunk);
+      });
+    }
+
+    it("passes the entries of the region to next() in chunks", function(done) {
+      async.series([
+        function(next) { region.putAll({"foo": 1, "bar": 2, "baz": 3}, next); },
+        function(next) {
+          collect(region.iterateEntries({ chunkSize: 2 }), function(error, chunks) {
+            expect(error).not.toBeError();
+            expect(_.map(chunks, "length")).toEqual([2, 1]);
+            var pairs = _.flatten(chunks);
+            expect(pairs).toContain({ "key" : "foo", "value" : 1});
+            expect(pairs).toContain({ "key" : "bar", "value" : 2});
+            expect(pairs).toContain({ "key" : "baz", "value" : 3});
+            next();
+          });
+        },
+      ], done);
+    });
+
+    it("iterates keys, server keys and values", function(done) {
+      async.series([
+        function(next) { region.putAll({"foo": 1, "bar": 2}, next); },
+        function(next) {
+          collect(region.iterateKeys({ chunkSize: 1 }), function(error, chunks) {
+            expect(error).not.toBeError();
+            expect(_.flatten(chunks).sort()).toEqual(["bar", "foo"]);
+            next();
+          });
+        },
+        function(next) {
+          collect(region.iterateServerKeys(), function(error, chunks) {
+            expect(error).not.toBeError();
+            expect(_.flatten(chunks).sort()).toEqual(["bar", "foo"]);
+            next();
+          });
+        },
+        function(next) {
+          collect(region.iterateValues(), function(error, chunks) {
+            expect(error).not.toBeError();
+            expect(_.flatten(chunks).sort()).toEqual([1, 2]);
+            next();
+          });
+        },
+      ], done);
+    });
+
+    it("delivers null after close()", function(done) {
+      async.series([
+        function(next) { region.putAll({"foo": 1, "bar": 2}, next); },
+        function(next) {
+          var iterator = region.iterateEntries({ chunkSize: 1 });
+          iterator.next(function(error, chunk) {
+            expect(error).not.toBeError();
+            expect(chunk.length).toEqual(1);
+            iterator.close();
+            iterator.next(function(error, chunk) {
+              expect(error).not.toBeError();
+              expect(chunk).toBeNull();
+              next();
+            });
+          });
+        },
+      ], done);
+    });
+
+    it("throws an exception when next() is called while a chunk is pending", function() {
+      var iterator = region.iterateEntries();
+      iterator.next(function() {});
+
+      expect(function() { iterator.next(function() {}); })
+        .toThrow(new Error("next() was called before the previous chunk was delivered."));
+    });
+
+    it("throws an exception when chunkSize is not a positive integer", function() {
+      expect(function() { region.iterateEntries({ chunkSize: 0 }); })
+        .toThrow(new Error("iterateEntries: chunkSize must be a positive integer."));
+    });
+  });
+
   describe("events", function() {
+    describe("capture", function() {
+      it("stops delivering events once the last listener is removed", function(done) {
+        const listener = jasmine.createSpy("listener");
+        region.on("create", listener);
+        region.removeListener("create", listener);
+
+        region.put("foo", "bar", function(error) {
+          expect(error).not.toBeError();
+          _.delay(function() {
+            expect(listener).not.toHaveBeenCalled();
+            done();
+          }, 100);
+        });
+      });
+
+      it("captures only the event types that have listeners", function(done) {
+        const updateListener = jasmine.createSpy("updateListener");
+        region.on("update", updateListener);
+        region.on("create", function(event) {
+          expect(event.key).toEqual("foo");
+          _.delay(function() {
+            expect(updateListener).not.toHaveBeenCalled();
+            region.removeAllListeners("update");
+            done();
+          }, 100);
+        });
+
+        region.put("foo", "bar");
+      });
+
+      it("keeps capturing events after removeAllListeners(\"newListener\")", function(done) {
+        const ownListener = jasmine.createSpy("newListener");
+        region.on("newListener", ownListener);
+        region.removeAllListeners("newListener");
+        region.removeAllListeners("removeListener");
+
+        region.on("create", function(event) {
+          expect(event.key).toEqual("foo");
+          expect(ownListener).not.toHaveBeenCalled();
+          region.removeAllListeners("create");
+          done();
+        });
+
+        region.put("foo", "bar");
+      });
+
+      it("delivers events to listeners added after removeAllListeners()", function(done) {
+        region.on("create", function() {});
+        region.removeAllListeners();
+
+        region.on("create", function(event) {
+          expect(event.key).toEqual("foo");
+          done();
+        });
+
+        region.put("foo", "bar");
+      });
+    });
+
+    describe("conflation", function() {
+      afterEach(function() {
+        region.setEventConflation(false);
+        region.removeAllListeners();
+      });
+
+      it("requires an options object or false", function() {
+        expect(function() { region.setEventConflation(); }).toThrow(
+          new Error("You must pass an options object or false to setEventConflation().")
+        );
+        expect(function() { region.setEventConflation({ keepOldValue: "yes" }); }).toThrow(
+          new Error("setEventConflation: keepOldValue must be a boolean.")
+        );
+      });
+
+      it("does not merge events of different types", function(done) {
+        region.putSync("foo", "bar");
+        region.setEventConflation({ keepOldValue: true });
+
+        const events = [];
+        region.on("destroy", function(event) { events.push("destroy " + event.key); });
+        region.on("create", function(event) { events.push("create " + event.key); });
+
+        region.removeAllSync(["foo"]);
+        region.putSync("foo", "baz");
+
+        _.delay(function() {
+          expect(events).toEqual(["destroy foo", "create foo"]);
+          done();
+        }, 100);
+      });
+
+      it("keeps the order of events across conflated and unconflated regions", function(done) {
+        const otherRegion = cache.getRegion("exampleProxyRegion");
+        region.setEventConflation({ keepOldValue: true });
+
+        const keys = [];
+        function recordKey(event) { keys.push(event.key); }
+        _.each([region, otherRegion], function(eventRegion) {
+          eventRegion.on("create", recordKey);
+          eventRegion.on("update", recordKey);
+        });
+
+        region.putSync("order1", 1);
+        otherRegion.putSync("order2", 2);
+        region.putSync("order3", 3);
+        otherRegion.putSync("order4", 4);
+
+        _.delay(function() {
+          expect(keys).toEqual(["order1", "order2", "order3", "order4"]);
+          _.each([region, otherRegion], function(eventRegion) {
+            eventRegion.removeListener("create", recordKey);
+            eventRegion.removeListener("update", recordKey);
+          });
+          otherRegion.removeAllSync(["order2", "order4"]);
+          done();
+        }, 100);
+      });
+
+      it("merges updates to a key made before its event is emitted", function(done) {
+        region.putSync("foo", 0);
+        region.setEventConflation({ keepOldValue: true });
+
+        const events = [];
+        region.on("update", function(event) { events.push(event); });
+
+        const before = gemfire.eventStats();
+        _.times(100, function(i) { region.putSync("foo", i + 1); });
+
+        _.delay(function() {
+          expect(events.length).toBeLessThan(100);
+          expect(_.last(events)).toEqual(jasmine.objectContaining({ key: "foo", newValue: 100 }));
+          expect(events[0].oldValue).toEqual(0);
+          expect(gemfire.eventStats().conflatedEvents).toBeGreaterThan(before.conflatedEvents);
+          done();
+        }, 100);
+      });
+    });
+
+    describe("batch", function() {
+      afterEach(function() {
+        region.removeAllListeners("batch");
+      });
+
+      it("delivers the events drained in one wakeup as one array", function(done) {
+        region.on("batch", function(events) {
+          expect(events).toEqual([
+            jasmine.objectContaining({ type: "create", key: "foo", newValue: 1 }),
+            jasmine.objectContaining({ type: "update", key: "foo", oldValue: 1, newValue: 2 }),
+            jasmine.objectContaining({ type: "destroy", key: "foo", oldValue: 2 })
+          ]);
+          done();
+        });
+
+        region.putSync("foo", 1);
+        region.putSync("foo", 2);
+        region.removeAllSync(["foo"]);
+      });
+
+      it("does not emit the individual events", function(done) {
+        region.on("batch", function(events) {
+          expect(events.length).toEqual(1);
+          expect(_.map(emit.calls.allArgs(), _.first)).toEqual(["batch"]);
+          done();
+        });
+        const emit = spyOn(region, "emit").and.callThrough();
+
+        region.putSync("foo", "bar");
+      });
+
+      it("emits the individual events to their own listeners as well", function(done) {
+        const createListener = jasmine.createSpy("createListener");
+        region.on("create", createListener);
+        region.on("batch", function(events) {
+          expect(events.length).toEqual(1);
+          expect(createListener).toHaveBeenCalledWith(jasmine.objectContaining({ key: "foo" }));
+          region.removeAllListeners("create");
+          done();
+        });
+
+        region.putSync("foo", "bar");
+      });
+    });
+
     describe("create", function() {
       beforeEach(function() {
         region = cache.getRegion("createEventTest");
@@ -63,6 +63,53 @@ describe("SelectResults", function() {
     });
   });
 
+  describe("projections", function() {
+    var projectionResults;
+
+    beforeEach(function(done) {
+      const region = cache.getRegion('exampleRegion');
+
+      async.series([
+        function(next) { region.clear(next); },
+        function(next) {
+          region.putAll({
+            "1": { name: "one", number: 1 },
+            "2": { name: "two", number: 2 }
+          }, next);
+        },
+        function(next) {
+          const query = "SELECT name, number FROM /exampleRegion ORDER BY number";
+          cache.executeQuery(query, {poolName: "myPool"}, function(error, response){
+            expect(error).not.toBeError();
+            projectionResults = response;
+            next();
+          });
+        }
+      ], done);
+    });
+
+    it("returns each row as an object keyed by field name", function() {
+      expect(projectionResults.toArray()).toEqual([
+        { name: "one", number: 1 },
+        { name: "two", number: 2 }
+      ]);
+    });
+
+    it("returns each row as an array of field values with the tuples option", function() {
+      expect(projectionResults.toArray({ tuples: true })).toEqual([["one", 1], ["two", 2]]);
+    });
+
+    it("passes tuples to the each callback with the tuples option", function() {
+      const callback = jasmine.createSpy();
+
+      projectionResults.each({ tuples: true }, callback);
+
+      expect(callback.calls.count()).toEqual(2);
+      expect(callback).toHaveBeenCalledWith(["one", 1]);
+      expect(callback).toHaveBeenCalledWith(["two", 2]);
+    });
+  });
+
   describe(".inspect", function() {
     it("returns a user-friendly display string describing the select results", function() {
       expect(selectResults.inspect()).toEqual('[SelectResults size=3]');
@@ -8,6 +8,11 @@
 #include "region.hpp"
 #include "cache_factory.hpp"
 #include "select_results.hpp"
+#include "region_event_registry.hpp"
+#include "region_iterator.hpp"
+#include "conversions.hpp"
+#include "thread_pool.hpp"
+#include "result_stream.hpp"
 
 using namespace v8;
 using namespace apache::geode::client;
@@ -20,6 +25,179 @@ NAN_METHOD(Connected) {
   info.GetReturnValue().Set(Nan::New(distributedSystemPtr->isConnected()));
 }
 
+NAN_METHOD(GetConversionStats) {
+  Nan::HandleScope scope;
+  const ConversionStats & stats(conversionStats());
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("pdxPlanCacheHits").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.pdxPlanCacheHits)));
+  Nan::Set(returnValue, Nan::New("pdxPlanCacheMisses").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.pdxPlanCacheMisses)));
+  Nan::Set(returnValue, Nan::New("pdxPlanCacheSize").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.pdxPlanCacheSize)));
+  Nan::Set(returnValue, Nan::New("pdxShapeCacheSize").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.pdxShapeCacheSize)));
+
+  info.GetReturnValue().Set(returnValue);
+}
+
+NAN_METHOD(SetThreadPoolSize) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsNumber() || info[0]->NumberValue() < 1 ||
+      info[0]->NumberValue() > ThreadPool::maxSize || info[0]->NumberValue() != info[0]->Uint32Value()) {
+    Nan::ThrowError("setThreadPoolSize: size must be an integer between 1 and 1024.");
+    return;
+  }
+
+  unsigned int size = info[0]->Uint32Value();
+  unsigned int reservedPointThreads = 0;
+
+  if (info[1]->IsObject()) {
+    Local<Value> reserved(info[1]->ToObject()->Get(Nan::New("reservedPointThreads").ToLocalChecked()));
+    if (!reserved->IsUndefined()) {
+      if (!reserved->IsNumber() || reserved->NumberValue() < 0 ||
+          reserved->NumberValue() >= size || reserved->NumberValue() != reserved->Uint32Value()) {
+        Nan::ThrowError("setThreadPoolSize: reservedPointThreads must be an integer less than size.");
+        return;
+      }
+      reservedPointThreads = reserved->Uint32Value();
+    }
+  }
+
+  ThreadPool::getInstance().setSize(size, reservedPointThreads);
+}
+
+static Local<Object> v8LaneStats(const ThreadPool::LaneStats & stats) {
+  Nan::EscapableHandleScope scope;
+
+  double completedTasks = static_cast<double>(stats.completedTasks);
+  double averageQueueTime = stats.completedTasks > 0 ? stats.totalQueueNanos / 1e6 / completedTasks : 0;
+
+  Local<Object> v8Stats(Nan::New<Object>());
+  Nan::Set(v8Stats, Nan::New("busyThreads").ToLocalChecked(), Nan::New(stats.busyThreads));
+  Nan::Set(v8Stats, Nan::New("queueDepth").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.queueDepth)));
+  Nan::Set(v8Stats, Nan::New("completedTasks").ToLocalChecked(), Nan::New<Number>(completedTasks));
+  Nan::Set(v8Stats, Nan::New("averageQueueTimeMs").ToLocalChecked(), Nan::New<Number>(averageQueueTime));
+  Nan::Set(v8Stats, Nan::New("maxQueueTimeMs").ToLocalChecked(),
+      Nan::New<Number>(stats.maxQueueNanos / 1e6));
+  return scope.Escape(v8Stats);
+}
+
+NAN_METHOD(GetThreadPoolStats) {
+  Nan::HandleScope scope;
+  ThreadPool::Stats stats(ThreadPool::getInstance().stats());
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("size").ToLocalChecked(), Nan::New(stats.size));
+  Nan::Set(returnValue, Nan::New("reservedPointThreads").ToLocalChecked(),
+      Nan::New(stats.reservedPointThreads));
+  Nan::Set(returnValue, Nan::New("threads").ToLocalChecked(), Nan::New(stats.threads));
+  Nan::Set(returnValue, Nan::New("busyThreads").ToLocalChecked(), Nan::New(stats.busyThreads));
+  Nan::Set(returnValue, Nan::New("queueDepth").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.queueDepth)));
+  Nan::Set(returnValue, Nan::New("keyWaitingTasks").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.keyWaitingTasks)));
+  Nan::Set(returnValue, Nan::New("completedTasks").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.completedTasks)));
+
+  Local<Object> lanes(Nan::New<Object>());
+  Nan::Set(lanes, Nan::New("point").ToLocalChecked(), v8LaneStats(stats.lanes[ThreadPool::POINT_LANE]));
+  Nan::Set(lanes, Nan::New("bulk").ToLocalChecked(), v8LaneStats(stats.lanes[ThreadPool::BULK_LANE]));
+  Nan::Set(returnValue, Nan::New("lanes").ToLocalChecked(), lanes);
+
+  info.GetReturnValue().Set(returnValue);
+}
+
+static const char * overflowNames[] = { "block", "dropOldest", "dropNewest", "conflate" };
+
+NAN_METHOD(SetEventQueueCapacity) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsNumber() || info[0]->NumberValue() < 0 ||
+      info[0]->NumberValue() != info[0]->Uint32Value()) {
+    Nan::ThrowError("setEventQueueCapacity: capacity must be a non-negative integer.");
+    return;
+  }
+
+  EventStream::Overflow overflow = EventStream::BLOCK_PRODUCER;
+
+  if (info[1]->IsObject()) {
+    Local<Value> v8Overflow(info[1]->ToObject()->Get(Nan::New("overflow").ToLocalChecked()));
+    if (!v8Overflow->IsUndefined()) {
+      std::string overflowName(*Nan::Utf8String(v8Overflow));
+      size_t i = 0;
+      while (i < 4 && overflowName != overflowNames[i]) {
+        i++;
+      }
+      if (!v8Overflow->IsString() || i == 4) {
+        Nan::ThrowError(
+            "setEventQueueCapacity: overflow must be \"block\", \"dropOldest\", \"dropNewest\" or \"conflate\".");
+        return;
+      }
+      overflow = static_cast<EventStream::Overflow>(i);
+    }
+  }
+
+  RegionEventRegistry::getInstance()->setEventQueueCapacity(info[0]->Uint32Value(), overflow);
+}
+
+NAN_METHOD(GetEventStats) {
+  Nan::HandleScope scope;
+  EventStream::Stats stats(RegionEventRegistry::getInstance()->eventStats());
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("queuedEvents").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.queuedEvents)));
+  Nan::Set(returnValue, Nan::New("conflatedEvents").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.conflatedEvents)));
+  Nan::Set(returnValue, Nan::New("pendingEvents").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.pendingEvents)));
+  Nan::Set(returnValue, Nan::New("highWaterMark").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.highWaterMark)));
+  Nan::Set(returnValue, Nan::New("droppedEvents").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.droppedEvents)));
+  Nan::Set(returnValue, Nan::New("blockedEvents").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.blockedEvents)));
+  Nan::Set(returnValue, Nan::New("capacity").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.capacity)));
+  Nan::Set(returnValue, Nan::New("overflow").ToLocalChecked(),
+      Nan::New(overflowNames[stats.overflow]).ToLocalChecked());
+
+  info.GetReturnValue().Set(returnValue);
+}
+
+NAN_METHOD(SetResultQueueCapacity) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsNumber() || info[0]->NumberValue() < 0 ||
+      info[0]->NumberValue() != info[0]->Uint32Value()) {
+    Nan::ThrowError("setResultQueueCapacity: capacity must be a non-negative integer.");
+    return;
+  }
+
+  ResultStream::setCapacity(info[0]->Uint32Value());
+}
+
+NAN_METHOD(GetResultQueueStats) {
+  Nan::HandleScope scope;
+  ResultStream::Stats stats(ResultStream::stats());
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("pendingResults").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.pendingResults)));
+  Nan::Set(returnValue, Nan::New("highWaterMark").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.highWaterMark)));
+  Nan::Set(returnValue, Nan::New("blockedResults").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.blockedResults)));
+  Nan::Set(returnValue, Nan::New("capacity").ToLocalChecked(),
+      Nan::New<Number>(static_cast<double>(stats.capacity)));
+
+  info.GetReturnValue().Set(returnValue);
+}
+
 NAN_METHOD(Initialize) {
   Nan::HandleScope scope;
 
@@ -37,9 +215,38 @@ NAN_METHOD(Initialize) {
       Nan::New<FunctionTemplate>(Connected)->GetFunction(),
       static_cast<PropertyAttribute>(ReadOnly | DontDelete));
 
+  Nan::DefineOwnProperty(gemfire, Nan::New("conversionStats").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(GetConversionStats)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
+  Nan::DefineOwnProperty(gemfire, Nan::New("setThreadPoolSize").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(SetThreadPoolSize)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
+  Nan::DefineOwnProperty(gemfire, Nan::New("threadPoolStats").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(GetThreadPoolStats)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
+  Nan::DefineOwnProperty(gemfire, Nan::New("setEventQueueCapacity").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(SetEventQueueCapacity)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
+  Nan::DefineOwnProperty(gemfire, Nan::New("eventStats").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(GetEventStats)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
+  Nan::DefineOwnProperty(gemfire, Nan::New("setResultQueueCapacity").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(SetResultQueueCapacity)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
+  Nan::DefineOwnProperty(gemfire, Nan::New("resultQueueStats").ToLocalChecked(),
+      Nan::New<FunctionTemplate>(GetResultQueueStats)->GetFunction(),
+      static_cast<PropertyAttribute>(ReadOnly | DontDelete));
+
   node_gemfire::Cache::Init(gemfire);
   node_gemfire::Region::Init(gemfire);
   node_gemfire::SelectResults::Init(gemfire);
+  node_gemfire::RegionIterator::Init(gemfire);
   node_gemfire::CacheFactory::Init(gemfire);
 
   dependencies.Reset(v8::Isolate::GetCurrent(),info[0]->ToObject());
@@ -6,6 +6,7 @@
 #include <geode/CacheFactory.hpp>
 #include <geode/Region.hpp>
 #include <string>
+#include <set>
 #include <sstream>
 #include "exceptions.hpp"
 #include "conversions.hpp"
@@ -41,6 +42,8 @@ NAN_MODULE_INIT(Cache::Init) {
   Nan::SetPrototypeMethod(constructorTemplate, "createRegion", Cache::CreateRegion);
   Nan::SetPrototypeMethod(constructorTemplate, "getRegion", Cache::GetRegion);
   Nan::SetPrototypeMethod(constructorTemplate, "rootRegions", Cache::RootRegions);
+  Nan::SetPrototypeMethod(constructorTemplate, "setConversionOptions", Cache::SetConversionOptions);
+  Nan::SetPrototypeMethod(constructorTemplate, "getConversionOptions", Cache::GetConversionOptions);
   Nan::SetPrototypeMethod(constructorTemplate, "inspect", Cache::Inspect);
 
   constructor().Reset(Nan::GetFunction(constructorTemplate).ToLocalChecked());
@@ -118,6 +121,7 @@ NAN_METHOD(Cache::ExecuteQuery) {
 
   Local<Function> callbackFunction;
   Local<Value> poolNameValue(Nan::Undefined());
+  Local<Value> options(Nan::Undefined());
   Local<Value> queryParams;
 
   if (info[1]->IsFunction()) {
@@ -126,6 +130,7 @@ NAN_METHOD(Cache::ExecuteQuery) {
     callbackFunction = info[2].As<Function>();
 
     if (info[1]->IsObject() && !info[1]->IsFunction()) {
+      options = info[1];
       Local<Object> optionsObject = info[1]->ToObject();
       poolNameValue = optionsObject->Get(Nan::New("poolName").ToLocalChecked());
     }
@@ -137,6 +142,7 @@ NAN_METHOD(Cache::ExecuteQuery) {
     }
 
     if (info[2]->IsObject() && !info[2]->IsFunction()) {
+      options = info[2];
       Local<Object> optionsObject = info[2]->ToObject();
       poolNameValue = optionsObject->Get(Nan::New("poolName").ToLocalChecked());
     }
@@ -145,6 +151,11 @@ NAN_METHOD(Cache::ExecuteQuery) {
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(options, lane)) {
+    return;
+  }
+
   Cache * cache = Nan::ObjectWrap::Unwrap<Cache>(info.This());
   CachePtr cachePtr(cache->cachePtr);
 
@@ -188,7 +199,7 @@ NAN_METHOD(Cache::ExecuteQuery) {
   Nan::Callback * callback = new Nan::Callback(callbackFunction);
 
   ExecuteQueryWorker * worker = new ExecuteQueryWorker(queryPtr, queryParamsPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 
   info.GetReturnValue().Set(info.This());
 }
@@ -292,6 +303,131 @@ NAN_METHOD(Cache::RootRegions) {
   info.GetReturnValue().Set(rootRegions);
 }
 
+NAN_METHOD(Cache::SetConversionOptions) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsObject()) {
+    Nan::ThrowError("setConversionOptions: You must pass an options object.");
+    return;
+  }
+
+  Local<Object> optionsObject(info[0]->ToObject());
+  ConversionOptions options(conversionOptions());
+
+  Local<Value> int64(optionsObject->Get(Nan::New("int64").ToLocalChecked()));
+  if (!int64->IsUndefined()) {
+    std::string int64Mode(*Nan::Utf8String(int64));
+    if (int64Mode == "number") {
+      options.int64Mode = INT64_AS_NUMBER;
+    } else if (int64Mode == "bigint") {
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+      options.int64Mode = INT64_AS_BIGINT;
+#else
+      Nan::ThrowError("setConversionOptions: BigInt is not supported by this version of Node.");
+      return;
+#endif
+    } else {
+      Nan::ThrowError("setConversionOptions: int64 must be \"number\" or \"bigint\".");
+      return;
+    }
+  }
+
+  Local<Value> numbers(optionsObject->Get(Nan::New("numbers").ToLocalChecked()));
+  if (!numbers->IsUndefined()) {
+    std::string numberMode(*Nan::Utf8String(numbers));
+    if (numberMode == "double") {
+      options.numberMode = NUMBERS_AS_DOUBLES;
+    } else if (numberMode == "integer") {
+      options.numberMode = NUMBERS_AS_INTEGERS;
+    } else {
+      Nan::ThrowError("setConversionOptions: numbers must be \"double\" or \"integer\".");
+      return;
+    }
+  }
+
+  Local<Value> dictionaryKeyCount(optionsObject->Get(Nan::New("dictionaryKeyCount").ToLocalChecked()));
+  if (!dictionaryKeyCount->IsUndefined()) {
+    if (!dictionaryKeyCount->IsNumber() || dictionaryKeyCount->NumberValue() < 0 ||
+        dictionaryKeyCount->NumberValue() != dictionaryKeyCount->Uint32Value()) {
+      Nan::ThrowError("setConversionOptions: dictionaryKeyCount must be a non-negative integer.");
+      return;
+    }
+    options.dictionaryKeyCount = dictionaryKeyCount->Uint32Value();
+  }
+
+  Local<Value> dictionaryIntegerKeys(optionsObject->Get(Nan::New("dictionaryIntegerKeys").ToLocalChecked()));
+  if (!dictionaryIntegerKeys->IsUndefined()) {
+    if (!dictionaryIntegerKeys->IsBoolean()) {
+      Nan::ThrowError("setConversionOptions: dictionaryIntegerKeys must be a boolean.");
+      return;
+    }
+    options.dictionaryIntegerKeys = dictionaryIntegerKeys->BooleanValue();
+  }
+
+  Local<Value> dictionaryType(optionsObject->Get(Nan::New("dictionaryType").ToLocalChecked()));
+  if (!dictionaryType->IsUndefined()) {
+    std::string dictionaryTypeName(*Nan::Utf8String(dictionaryType));
+    if (dictionaryTypeName == "object") {
+      options.dictionaryType = DICTIONARIES_AS_OBJECTS;
+    } else if (dictionaryTypeName == "map") {
+      options.dictionaryType = DICTIONARIES_AS_MAPS;
+    } else {
+      Nan::ThrowError("setConversionOptions: dictionaryType must be \"object\" or \"map\".");
+      return;
+    }
+  }
+
+  Local<Value> longFields(optionsObject->Get(Nan::New("longFields").ToLocalChecked()));
+  if (!longFields->IsUndefined()) {
+    if (!longFields->IsArray()) {
+      Nan::ThrowError("setConversionOptions: longFields must be an array of field names.");
+      return;
+    }
+    Local<Array> longFieldsArray(longFields.As<Array>());
+    std::set<std::string> longFieldNames;
+    for (unsigned int i = 0; i < longFieldsArray->Length(); i++) {
+      Local<Value> fieldName(longFieldsArray->Get(i));
+      if (!fieldName->IsString()) {
+        Nan::ThrowError("setConversionOptions: longFields must be an array of field names.");
+        return;
+      }
+      longFieldNames.insert(*Nan::Utf8String(fieldName));
+    }
+    options.longFields = longFieldNames;
+  }
+
+  conversionOptions() = options;
+  resetInt64Warnings();
+}
+
+NAN_METHOD(Cache::GetConversionOptions) {
+  Nan::HandleScope scope;
+
+  const ConversionOptions & options(conversionOptions());
+
+  Local<Object> returnValue(Nan::New<Object>());
+  Nan::Set(returnValue, Nan::New("int64").ToLocalChecked(),
+      Nan::New(options.int64Mode == INT64_AS_BIGINT ? "bigint" : "number").ToLocalChecked());
+  Nan::Set(returnValue, Nan::New("numbers").ToLocalChecked(),
+      Nan::New(options.numberMode == NUMBERS_AS_INTEGERS ? "integer" : "double").ToLocalChecked());
+  Nan::Set(returnValue, Nan::New("dictionaryKeyCount").ToLocalChecked(),
+      Nan::New(options.dictionaryKeyCount));
+  Nan::Set(returnValue, Nan::New("dictionaryIntegerKeys").ToLocalChecked(),
+      Nan::New(options.dictionaryIntegerKeys));
+  Nan::Set(returnValue, Nan::New("dictionaryType").ToLocalChecked(),
+      Nan::New(options.dictionaryType == DICTIONARIES_AS_MAPS ? "map" : "object").ToLocalChecked());
+
+  Local<Array> longFields(Nan::New<Array>());
+  for (std::set<std::string>::const_iterator iterator(options.longFields.begin());
+       iterator != options.longFields.end();
+       ++iterator) {
+    Nan::Set(longFields, longFields->Length(), Nan::New(*iterator).ToLocalChecked());
+  }
+  Nan::Set(returnValue, Nan::New("longFields").ToLocalChecked(), longFields);
+
+  info.GetReturnValue().Set(returnValue);
+}
+
 NAN_METHOD(Cache::Inspect) {
   Nan::HandleScope scope;
   info.GetReturnValue().Set(Nan::New("[Cache]").ToLocalChecked());
@@ -33,6 +33,8 @@ class Cache : public Nan::ObjectWrap {
   static NAN_METHOD(CreateRegion);
   static NAN_METHOD(GetRegion);
   static NAN_METHOD(RootRegions);
+  static NAN_METHOD(SetConversionOptions);
+  static NAN_METHOD(GetConversionOptions);
   static NAN_METHOD(Inspect);
 
  private:
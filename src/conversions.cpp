@@ -3,13 +3,19 @@
 #include <nan.h>
 #include <v8.h>
 #include <math.h>
+#include <uv.h>
 #include <geode/GeodeCppCache.hpp>
+#include <cstring>
 #include <string>
 #include <sstream>
 #include <set>
+#include <unordered_map>
+#include <vector>
 #include "conversions.hpp"
 #include "exceptions.hpp"
+#include "pdx_shapes.hpp"
 #include "select_results.hpp"
+#include "string_transcoding.hpp"
 
 using namespace std;
 using namespace chrono;
@@ -18,6 +24,57 @@ using namespace apache::geode::client;
 
 namespace node_gemfire {
 
+static ConversionOptions options = { INT64_AS_NUMBER, NUMBERS_AS_DOUBLES, 0, false, DICTIONARIES_AS_OBJECTS };
+
+ConversionOptions & conversionOptions() {
+  return options;
+}
+
+static const double maxSafeInteger = 9007199254740991.0;
+
+NumberKind numberKind(const Local<Value> & v8Value) {
+  if (options.numberMode != NUMBERS_AS_INTEGERS) {
+    return DOUBLE_NUMBER;
+  }
+
+  if (v8Value->IsInt32()) {
+    return INT32_NUMBER;
+  }
+
+  // -0 stays a double so that its sign survives the round trip.
+  double value = v8Value->NumberValue();
+  if (value != trunc(value) || fabs(value) > maxSafeInteger || (value == 0 && signbit(value))) {
+    return DOUBLE_NUMBER;
+  }
+  if (value >= INT32_MIN && value <= INT32_MAX) {
+    return INT32_NUMBER;
+  }
+  return INT64_NUMBER;
+}
+
+// Each PDX field is written according to its kind, which is therefore part of both the class name
+// and the conversion plan shape key. The kind of a numeric field depends on its name, not on its
+// value, so that {price: 10} and {price: 10.5} share one PDX type and each field keeps one Java type.
+static const char objectField = ',';
+static const char arrayField = ']';
+static const char longField = 'l';
+static const char doubleField = 'd';
+
+static char pdxFieldKind(const Local<Value> & v8Value, const char * fieldName, size_t size) {
+  if (v8Value->IsArray() && !v8Value->IsString()) {
+    return arrayField;
+  }
+
+  if (options.numberMode == NUMBERS_AS_INTEGERS && (v8Value->IsNumber() || v8Value->IsNumberObject())) {
+    if (!options.longFields.empty() && options.longFields.count(std::string(fieldName, size)) > 0) {
+      return longField;
+    }
+    return doubleField;
+  }
+
+  return objectField;
+}
+
 std::string getClassName(const Local<Object> & v8Object) {
    Nan::HandleScope scope;
 
@@ -48,8 +105,16 @@ std::string getClassName(const Local<Object> & v8Object) {
     }
 
     Local<Value> v8Value(v8Object->Get(v8Key));
-    if (v8Value->IsArray() && !v8Value->IsString()) {
-      fullFieldName += "[]";
+    switch (pdxFieldKind(v8Value, fieldName, size)) {
+      case arrayField:
+        fullFieldName += "[]";
+        break;
+      case longField:
+        fullFieldName += ":long";
+        break;
+      case doubleField:
+        fullFieldName += ":double";
+        break;
     }
     fullFieldName += ',';
 
@@ -67,41 +132,88 @@ std::string getClassName(const Local<Object> & v8Object) {
   return className;
 }
 
-std::wstring wstringFromV8String(const Local<String> & v8String) {
-  Nan::HandleScope scope;
+// Scratch space for UTF-16 code units; short strings stay on the stack.
+class Utf16Buffer {
+ public:
+  explicit Utf16Buffer(size_t length) :
+    data(length <= stackLength ? stackData : new uint16_t[length]) {}
 
-  String::Value v8StringValue(v8String);
-  uint16_t * v8StringData(*v8StringValue);
+  ~Utf16Buffer() {
+    if (data != stackData) {
+      delete[] data;
+    }
+  }
 
-  unsigned int length = v8String->Length();
-  wchar_t * buffer = new wchar_t[length + 1];
-  for (unsigned int i = 0; i < length; i++) {
-    buffer[i] = v8StringData[i];
+  uint16_t * get() {
+    return data;
   }
-  buffer[length] = 0;
 
-  std::wstring wstring(buffer);
-  delete[] buffer;
+ private:
+  static const size_t stackLength = 256;
+  uint16_t stackData[stackLength];
+  uint16_t * data;
+};
+
+static void writeWideString(const Local<String> & v8String, wchar_t * destination, int length) {
+  Utf16Buffer utf16(length);
+  v8String->Write(utf16.get(), 0, length, String::NO_NULL_TERMINATION);
+  widenUtf16(utf16.get(), destination, length);
+}
+
+std::wstring wstringFromV8String(const Local<String> & v8String) {
+  Nan::HandleScope scope;
+
+  int length = v8String->Length();
+  std::wstring wstring(length, L'\0');
+  if (length > 0) {
+    writeWideString(v8String, &wstring[0], length);
+  }
 
   return wstring;
 }
 
-Local<String> v8StringFromWstring(const std::wstring & wideString) {
+Local<String> v8StringFromWchar(const wchar_t * wideString, size_t length) {
   Nan::EscapableHandleScope scope;
 
-  unsigned int length = wideString.length();
-  uint16_t * buffer = new uint16_t[length + 1];
-  for (unsigned int i = 0; i < length; i++) {
-    buffer[i] = wideString[i];
-  }
-  buffer[length] = 0;
- 
-  Local<String> v8String = Nan::New(buffer).ToLocalChecked();
-  delete[] buffer;
+  Utf16Buffer utf16(length);
+  narrowToUtf16(wideString, utf16.get(), length);
 
+  Local<String> v8String = Nan::New(utf16.get(), length).ToLocalChecked();
   return scope.Escape(v8String);
 }
 
+Local<String> v8StringFromWstring(const std::wstring & wideString) {
+  return v8StringFromWchar(wideString.data(), wideString.length());
+}
+
+CacheableStringPtr gemfireValue(const Local<String> & v8String) {
+  int length = v8String->Length();
+
+  if (stringFastPaths() && v8String->IsOneByte()) {
+    char * buffer = new char[length + 1];
+    v8String->WriteOneByte(reinterpret_cast<uint8_t *>(buffer), 0, length, String::NO_NULL_TERMINATION);
+    buffer[length] = '\0';
+
+    if (isAscii(buffer, length)) {
+      return CacheableString::createNoCopy(buffer, length);
+    }
+
+    // Latin-1 beyond ASCII would be read back as UTF-8, so store it as a wide string.
+    wchar_t * wideBuffer = new wchar_t[length + 1];
+    for (int i = 0; i < length; i++) {
+      wideBuffer[i] = static_cast<unsigned char>(buffer[i]);
+    }
+    wideBuffer[length] = L'\0';
+    delete[] buffer;
+    return CacheableString::createNoCopy(wideBuffer, length);
+  }
+
+  wchar_t * wideBuffer = new wchar_t[length + 1];
+  writeWideString(v8String, wideBuffer, length);
+  wideBuffer[length] = L'\0';
+  return CacheableString::createNoCopy(wideBuffer, length);
+}
+
 void ConsoleWarn(const char * message) {
    Nan::HandleScope scope;
 
@@ -113,19 +225,90 @@ void ConsoleWarn(const char * message) {
   callback.Call(1, argv);
 }
 
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+CacheableInt64Ptr gemfireValue(const Local<BigInt> & v8BigInt) {
+  bool lossless = true;
+  int64_t value = v8BigInt->Int64Value(&lossless);
+  if (!lossless) {
+    Nan::ThrowError("Unable to serialize to GemFire; BigInt values must fit in a signed 64 bit integer.");
+    return NULLPTR;
+  }
+  return CacheableInt64::create(value);
+}
+#endif
+
+static bool isIntegerKey(const Local<Value> & v8Key) {
+  if (v8Key->IsNumber()) {
+    return true;
+  }
+
+  Nan::Utf8String key(v8Key);
+  if (key.length() == 0) {
+    return false;
+  }
+  for (int i = 0; i < key.length(); i++) {
+    if ((*key)[i] < '0' || (*key)[i] > '9') {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Objects used as maps, such as { [userId]: score }, would register a PDX type per distinct key set.
+static bool isDictionary(const Local<Object> & v8Object) {
+  if (options.dictionaryKeyCount == 0 && !options.dictionaryIntegerKeys) {
+    return false;
+  }
+
+  Local<Array> v8Keys(v8Object->GetOwnPropertyNames());
+  unsigned int length = v8Keys->Length();
+  if (options.dictionaryKeyCount > 0 && length >= options.dictionaryKeyCount) {
+    return true;
+  }
+  if (!options.dictionaryIntegerKeys || length == 0) {
+    return false;
+  }
+
+  for (unsigned int i = 0; i < length; i++) {
+    if (!isIntegerKey(v8Keys->Get(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static CacheablePtr gemfireNumber(const Local<Value> & v8Value) {
+  double value = v8Value->NumberValue();
+  switch (numberKind(v8Value)) {
+    case INT32_NUMBER:
+      return CacheableInt32::create(static_cast<int32_t>(value));
+    case INT64_NUMBER:
+      return CacheableInt64::create(static_cast<int64_t>(value));
+    case DOUBLE_NUMBER:
+      break;
+  }
+  return CacheableDouble::create(value);
+}
+
 CacheablePtr gemfireValue(const Local<Value> & v8Value, const CachePtr & cachePtr) {
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+  if (v8Value->IsBigInt()) {
+    return gemfireValue(Local<BigInt>::Cast(v8Value));
+  }
+#endif
+
   if (v8Value->IsString() || v8Value->IsStringObject()) {
-    std::wstring wideString = wstringFromV8String(v8Value->ToString());
-    const wchar_t* readOnlyWideChar = wideString.c_str();
-    return CacheableString::create(readOnlyWideChar);
+    return gemfireValue(v8Value->ToString());
   } else if (v8Value->IsBoolean()) {
     return CacheableBoolean::create(v8Value->ToBoolean()->Value());
   } else if (v8Value->IsNumber() || v8Value->IsNumberObject()) {
-    return CacheableDouble::create(v8Value->ToNumber()->Value());
+    return gemfireNumber(v8Value);
   } else if (v8Value->IsDate()) {
     return gemfireValue(Local<Date>::Cast(v8Value));
   } else if (v8Value->IsArray()) {
     return gemfireValue(Local<Array>::Cast(v8Value), cachePtr);
+  } else if (v8Value->IsArrayBufferView()) {
+    return gemfireValue(Local<ArrayBufferView>::Cast(v8Value));
   } else if (v8Value->IsBooleanObject()) {
 #if (NODE_MODULE_VERSION > 0x000B)
     return CacheableBoolean::create(BooleanObject::Cast(*v8Value)->ValueOf());
@@ -135,8 +318,14 @@ CacheablePtr gemfireValue(const Local<Value> & v8Value, const CachePtr & cachePt
   } else if (v8Value->IsFunction()) {
     Nan::ThrowError("Unable to serialize to GemFire; functions are not supported.");
     return NULLPTR;
+  } else if (v8Value->IsMap()) {
+    return gemfireDictionary(Local<Map>::Cast(v8Value), cachePtr);
   } else if (v8Value->IsObject()) {
-    return gemfireValue(v8Value->ToObject(), cachePtr);
+    Local<Object> v8Object(v8Value->ToObject());
+    if (isDictionary(v8Object)) {
+      return gemfireDictionary(v8Object, cachePtr);
+    }
+    return gemfireValue(v8Object, cachePtr);
   } else if (v8Value->IsUndefined()) {
     return CacheableUndefined::create();
   } else if (v8Value->IsNull()) {
@@ -149,19 +338,112 @@ CacheablePtr gemfireValue(const Local<Value> & v8Value, const CachePtr & cachePt
   }
 }
 
+// A conversion plan holds everything about a PDX instance that depends only on the shape of the
+// JavaScript object: the PDX class name and the UTF-8 field names, in property order. Plans are
+// keyed by the own property names in order plus the pdxFieldKind() of each value, which is
+// exactly what getClassName() depends on.
+struct PdxConversionPlan {
+  std::string className;
+  std::vector<std::string> fieldNames;
+};
+
+typedef std::unordered_map<std::string, PdxConversionPlan> PdxConversionPlanCache;
+
+static const size_t maxPdxConversionPlans = 1024;
+static PdxConversionPlanCache pdxConversionPlanCache;
+static ConversionStats stats = ConversionStats();
+
+const ConversionStats & conversionStats() {
+  stats.pdxPlanCacheSize = pdxConversionPlanCache.size();
+  stats.pdxShapeCacheSize = pdxShapeCount();
+  return stats;
+}
+
+static void appendShapeField(std::string & shapeKey, const char * fieldName, uint32_t size, char fieldKind) {
+  // Length-prefix each name so that no field name can run into the next one.
+  shapeKey.append(reinterpret_cast<const char *>(&size), sizeof(size));
+  shapeKey.append(fieldName, size);
+  shapeKey += fieldKind;
+}
+
+static const PdxConversionPlan * pdxConversionPlan(const std::string & shapeKey,
+                                                   const Local<Object> & v8Object,
+                                                   PdxConversionPlan & uncachedPlan) {
+  PdxConversionPlanCache::const_iterator iterator(pdxConversionPlanCache.find(shapeKey));
+  if (iterator != pdxConversionPlanCache.end()) {
+    stats.pdxPlanCacheHits++;
+    return &iterator->second;
+  }
+
+  stats.pdxPlanCacheMisses++;
+
+  PdxConversionPlan plan;
+  plan.className = getClassName(v8Object);
+
+  Local<Array> v8Keys(v8Object->GetOwnPropertyNames());
+  unsigned int length = v8Keys->Length();
+  plan.fieldNames.reserve(length);
+  for (unsigned int i = 0; i < length; i++) {
+    Nan::Utf8String fieldName(v8Keys->Get(i));
+    plan.fieldNames.push_back(std::string(*fieldName, fieldName.length()));
+  }
+
+  if (pdxConversionPlanCache.size() >= maxPdxConversionPlans) {
+    uncachedPlan = plan;
+    return &uncachedPlan;
+  }
+
+  // References to unordered_map elements survive rehashing, so nested conversions may keep adding plans.
+  return &pdxConversionPlanCache.insert(std::make_pair(shapeKey, plan)).first->second;
+}
+
 PdxInstancePtr gemfireValue(const Local<Object> & v8Object, const CachePtr & cachePtr) {
     Nan::EscapableHandleScope scope;
   try {
-    std::string pdxClassName = getClassName(v8Object);
-    PdxInstanceFactoryPtr pdxInstanceFactory = cachePtr->createPdxInstanceFactory(pdxClassName.c_str());
     Local<Array> v8Keys(v8Object->GetOwnPropertyNames());
     unsigned int length = v8Keys->Length();
+
+    std::vector< Local<Value> > v8Values;
+    v8Values.reserve(length);
+
+    std::vector<char> fieldKinds;
+    fieldKinds.reserve(length);
+
+    std::string shapeKey;
     for (unsigned int i = 0; i < length; i++) {
       Local<Value> v8Key(v8Keys->Get(i));
       Local<Value> v8Value(v8Object->Get(v8Key));
       Nan::Utf8String fieldName(v8Key);
-      CacheablePtr cacheablePtr(gemfireValue(v8Value, cachePtr));
-      pdxInstanceFactory->writeObject(*fieldName, cacheablePtr);
+      char fieldKind = pdxFieldKind(v8Value, *fieldName, fieldName.length());
+      appendShapeField(shapeKey, *fieldName, fieldName.length(), fieldKind);
+      v8Values.push_back(v8Value);
+      fieldKinds.push_back(fieldKind);
+    }
+
+    PdxConversionPlan uncachedPlan;
+    const PdxConversionPlan * plan = pdxConversionPlan(shapeKey, v8Object, uncachedPlan);
+
+    PdxInstanceFactoryPtr pdxInstanceFactory = cachePtr->createPdxInstanceFactory(plan->className.c_str());
+    for (unsigned int i = 0; i < length; i++) {
+      const char * fieldName = plan->fieldNames[i].c_str();
+      switch (fieldKinds[i]) {
+        case longField: {
+          double value = v8Values[i]->NumberValue();
+          if (value != trunc(value) || fabs(value) > maxSafeInteger) {
+            std::string errorMessage("Unable to serialize to GemFire; long field is not a safe integer: ");
+            errorMessage.append(fieldName);
+            Nan::ThrowError(errorMessage.c_str());
+            return NULLPTR;
+          }
+          pdxInstanceFactory->writeLong(fieldName, static_cast<int64_t>(value));
+          break;
+        }
+        case doubleField:
+          pdxInstanceFactory->writeDouble(fieldName, v8Values[i]->NumberValue());
+          break;
+        default:
+          pdxInstanceFactory->writeObject(fieldName, gemfireValue(v8Values[i], cachePtr));
+      }
     }
     return pdxInstanceFactory->create();
   }
@@ -181,6 +463,60 @@ apache::geode::client::CacheableArrayListPtr gemfireValue(const Local<Array> & v
   return arrayListPtr;
 }
 
+template<typename TCacheableArray, typename TElement>
+static CacheablePtr gemfireArray(const Local<ArrayBufferView> & v8View) {
+  static const TElement emptyArray[1] = {};
+
+  // TypedArrayContents points into the backing store; create() makes the only copy.
+  Nan::TypedArrayContents<TElement> contents(v8View);
+  if (contents.length() == 0) {
+    return TCacheableArray::create(emptyArray, 0);
+  }
+  return TCacheableArray::create(*contents, contents.length());
+}
+
+template<typename TCacheableArray, typename TElement, typename TV8Element>
+static CacheablePtr gemfireWideningArray(const Local<ArrayBufferView> & v8View) {
+  Nan::TypedArrayContents<TV8Element> contents(v8View);
+  unsigned int length = contents.length();
+
+  TElement * buffer = new TElement[length > 0 ? length : 1];
+  for (unsigned int i = 0; i < length; i++) {
+    buffer[i] = (*contents)[i];
+  }
+  return TCacheableArray::createNoCopy(buffer, length);
+}
+
+CacheablePtr gemfireValue(const Local<ArrayBufferView> & v8View) {
+  if (v8View->IsUint8Array() || v8View->IsUint8ClampedArray() || v8View->IsInt8Array() || v8View->IsDataView()) {
+    return gemfireArray<CacheableBytes, uint8_t>(v8View);
+  } else if (v8View->IsInt16Array()) {
+    return gemfireArray<CacheableInt16Array, int16_t>(v8View);
+  } else if (v8View->IsInt32Array()) {
+    return gemfireArray<CacheableInt32Array, int32_t>(v8View);
+  } else if (v8View->IsFloat32Array()) {
+    return gemfireArray<CacheableFloatArray, float>(v8View);
+  } else if (v8View->IsFloat64Array()) {
+    return gemfireArray<CacheableDoubleArray, double>(v8View);
+  } else if (v8View->IsUint16Array()) {
+    // GemFire chars are wchar_t, so Java char[] needs widening from UTF-16 code units.
+    return gemfireWideningArray<CharArray, wchar_t, uint16_t>(v8View);
+  } else if (v8View->IsUint32Array()) {
+    // Java has no unsigned int; long[] holds every value exactly.
+    return gemfireWideningArray<CacheableInt64Array, int64_t, uint32_t>(v8View);
+  }
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+  if (v8View->IsBigInt64Array()) {
+    return gemfireArray<CacheableInt64Array, int64_t>(v8View);
+  }
+#endif
+
+  std::string errorMessage("Unable to serialize to GemFire; unsupported typed array: ");
+  errorMessage.append(*Nan::Utf8String(v8View->ToDetailString()));
+  Nan::ThrowError(errorMessage.c_str());
+  return NULLPTR;
+}
+
 apache::geode::client::CacheableDatePtr gemfireValue(const Local<Date> & v8Date) {
   long int millisecondsSinceEpoch = v8Date->NumberValue();
   std::chrono::milliseconds dur(millisecondsSinceEpoch);
@@ -242,6 +578,49 @@ HashMapOfCacheablePtr gemfireHashMap(const Local<Object> & v8Object,
   return hashMapPtr;
 }
 
+CacheableHashMapPtr gemfireDictionary(const Local<Object> & v8Object, const CachePtr & cachePtr) {
+  Nan::HandleScope scope;
+
+  CacheableHashMapPtr hashMapPtr(CacheableHashMap::create());
+
+  Local<Array> v8Keys(v8Object->GetOwnPropertyNames());
+  unsigned int length = v8Keys->Length();
+
+  for (unsigned int i = 0; i < length; i++) {
+    Local<String> v8Key(v8Keys->Get(i)->ToString());
+    hashMapPtr->insert(gemfireValue(v8Key), gemfireValue(v8Object->Get(v8Key), cachePtr));
+  }
+
+  return hashMapPtr;
+}
+
+CacheableHashMapPtr gemfireDictionary(const Local<Map> & v8Map, const CachePtr & cachePtr) {
+  Nan::HandleScope scope;
+
+  CacheableHashMapPtr hashMapPtr(CacheableHashMap::create());
+
+  // AsArray() alternates keys and values.
+  Local<Array> v8Entries(v8Map->AsArray());
+  unsigned int length = v8Entries->Length();
+
+  for (unsigned int i = 0; i + 1 < length; i += 2) {
+    Nan::TryCatch tryCatch;
+    CacheableKeyPtr keyPtr(gemfireKey(v8Entries->Get(i), cachePtr));
+    if (tryCatch.HasCaught()) {
+      tryCatch.ReThrow();
+      return NULLPTR;
+    }
+    if (keyPtr == NULLPTR) {
+      Nan::ThrowError("Unable to serialize to GemFire; Map keys must be valid GemFire keys.");
+      return NULLPTR;
+    }
+
+    hashMapPtr->insert(keyPtr, gemfireValue(v8Entries->Get(i + 1), cachePtr));
+  }
+
+  return hashMapPtr;
+}
+
 CacheableVectorPtr gemfireVector(const Local<Array> & v8Array, const CachePtr & cachePtr) {
   Nan::HandleScope scope;
 
@@ -255,7 +634,155 @@ CacheableVectorPtr gemfireVector(const Local<Array> & v8Array, const CachePtr &
   return vectorPtr;
 }
 
-Local<Value> v8Value(const CacheablePtr & valuePtr) {
+// Lets V8 read a long ASCII string straight out of the GemFire value instead of copying it.
+class ExternalAsciiString : public Nan::ExternalOneByteStringResource {
+ public:
+  explicit ExternalAsciiString(const CacheableStringPtr & stringPtr) :
+    stringPtr(stringPtr) {}
+
+  const char * data() const {
+    return stringPtr->asChar();
+  }
+
+  size_t length() const {
+    return stringPtr->length();
+  }
+
+ private:
+  CacheableStringPtr stringPtr;
+};
+
+Local<String> v8Value(const CacheableStringPtr & stringPtr) {
+  Nan::EscapableHandleScope scope;
+
+  int32_t length = stringPtr->length();
+  if (stringPtr->isWideString()) {
+    return scope.Escape(v8StringFromWchar(stringPtr->asWChar(), length));
+  }
+
+  const char * data = stringPtr->asChar();
+  if (!stringFastPaths() || !isAscii(data, length)) {
+    return scope.Escape(Nan::New(data, length).ToLocalChecked());
+  }
+
+  if (length >= minExternalStringLength) {
+    return scope.Escape(Nan::New<String>(new ExternalAsciiString(stringPtr)).ToLocalChecked());
+  }
+
+  return scope.Escape(Nan::NewOneByteString(reinterpret_cast<const uint8_t *>(data), length).ToLocalChecked());
+}
+
+// Keeps a GemFire array alive for as long as V8 holds an ArrayBuffer over its storage.
+class ExternalArrayBuffer {
+ public:
+  ExternalArrayBuffer(const CacheablePtr & cacheablePtr,
+                      const Local<ArrayBuffer> & arrayBuffer,
+                      size_t byteLength) :
+    cacheablePtr(cacheablePtr),
+    byteLength(byteLength) {
+      persistent.Reset(arrayBuffer);
+      persistent.SetWeak(this, WeakCallback, Nan::WeakCallbackType::kParameter);
+      Nan::AdjustExternalMemory(byteLength);
+    }
+
+  static void WeakCallback(const Nan::WeakCallbackInfo<ExternalArrayBuffer> & data) {
+    ExternalArrayBuffer * externalArrayBuffer = data.GetParameter();
+    Nan::AdjustExternalMemory(-static_cast<int>(externalArrayBuffer->byteLength));
+    delete externalArrayBuffer;
+  }
+
+ private:
+  CacheablePtr cacheablePtr;
+  size_t byteLength;
+  Nan::Persistent<ArrayBuffer> persistent;
+};
+
+static void releaseCacheableBytes(char * data, void * hint) {
+  delete static_cast<CacheableBytesPtr *>(hint);
+}
+
+Local<Object> v8Value(const CacheableBytesPtr & bytesPtr, ArrayStorage arrayStorage) {
+  Nan::EscapableHandleScope scope;
+
+  if (bytesPtr->length() == 0) {
+    return scope.Escape(Nan::NewBuffer(0).ToLocalChecked());
+  }
+
+  const char * data = reinterpret_cast<const char *>(bytesPtr->value());
+  if (arrayStorage == COPY_ARRAYS) {
+    return scope.Escape(Nan::CopyBuffer(data, bytesPtr->length()).ToLocalChecked());
+  }
+
+  Local<Object> buffer(Nan::NewBuffer(const_cast<char *>(data), bytesPtr->length(), releaseCacheableBytes,
+                                      new CacheableBytesPtr(bytesPtr)).ToLocalChecked());
+  return scope.Escape(buffer);
+}
+
+template<typename TV8Array, typename TCacheableArrayPtr>
+Local<Object> v8TypedArray(const TCacheableArrayPtr & arrayPtr, ArrayStorage arrayStorage) {
+  Nan::EscapableHandleScope scope;
+
+  size_t length = arrayPtr->length();
+  size_t byteLength = length * sizeof(*arrayPtr->value());
+  const void * data = static_cast<const void *>(arrayPtr->value());
+
+  if (arrayStorage == COPY_ARRAYS) {
+    Local<ArrayBuffer> arrayBuffer(ArrayBuffer::New(v8::Isolate::GetCurrent(), byteLength));
+    if (byteLength > 0) {
+      memcpy(arrayBuffer->GetContents().Data(), data, byteLength);
+    }
+    return scope.Escape(TV8Array::New(arrayBuffer, 0, length));
+  }
+
+  Local<ArrayBuffer> arrayBuffer(ArrayBuffer::New(v8::Isolate::GetCurrent(), const_cast<void *>(data),
+                                                  byteLength, ArrayBufferCreationMode::kExternalized));
+  new ExternalArrayBuffer(arrayPtr, arrayBuffer, byteLength);
+
+  return scope.Escape(TV8Array::New(arrayBuffer, 0, length));
+}
+
+Local<Object> v8Value(const CacheableInt64ArrayPtr & arrayPtr, ArrayStorage arrayStorage) {
+  Nan::EscapableHandleScope scope;
+
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+  if (conversionOptions().int64Mode == INT64_AS_BIGINT) {
+    return scope.Escape(v8TypedArray<BigInt64Array>(arrayPtr, arrayStorage));
+  }
+#endif
+
+  unsigned int length = arrayPtr->length();
+  Local<Array> v8Array(Nan::New<Array>(length));
+  for (unsigned int i = 0; i < length; i++) {
+    Nan::Set(v8Array, i, v8Int64(arrayPtr->value()[i]));
+  }
+  return scope.Escape(v8Array);
+}
+
+Local<Object> v8Value(const CharArrayPtr & arrayPtr) {
+  Nan::EscapableHandleScope scope;
+
+  unsigned int length = arrayPtr->length();
+  Local<Uint16Array> v8Array(Uint16Array::New(ArrayBuffer::New(v8::Isolate::GetCurrent(),
+                                                              length * sizeof(uint16_t)), 0, length));
+  Nan::TypedArrayContents<uint16_t> contents(v8Array);
+  for (unsigned int i = 0; i < length; i++) {
+    (*contents)[i] = arrayPtr->value()[i];
+  }
+  return scope.Escape(v8Array);
+}
+
+Local<Array> v8Value(const BooleanArrayPtr & arrayPtr) {
+  Nan::EscapableHandleScope scope;
+
+  unsigned int length = arrayPtr->length();
+  Local<Array> v8Array(Nan::New<Array>(length));
+  for (unsigned int i = 0; i < length; i++) {
+    Nan::Set(v8Array, i, Nan::New(arrayPtr->value()[i]));
+  }
+  return scope.Escape(v8Array);
+}
+
+Local<Value> v8Value(const CacheablePtr & valuePtr, ArrayStorage arrayStorage) {
  Nan::EscapableHandleScope scope;
 
   if (valuePtr == NULLPTR) {
@@ -268,14 +795,7 @@ Local<Value> v8Value(const CacheablePtr & valuePtr) {
     case GeodeTypeIds::CacheableASCIIStringHuge:
     case GeodeTypeIds::CacheableString:
     case GeodeTypeIds::CacheableStringHuge:
-    {  
-      CacheableStringPtr cacheableStringPtr = static_cast<CacheableStringPtr>(valuePtr);
-      if(cacheableStringPtr->isWideString()){
-        return scope.Escape(v8StringFromWstring(cacheableStringPtr->asWChar()));
-      }
-      //else
-      return scope.Escape(Nan::New(cacheableStringPtr->asChar()).ToLocalChecked());
-    }
+      return scope.Escape(v8Value(static_cast<CacheableStringPtr>(valuePtr)));
     case GeodeTypeIds::CacheableBoolean:
       return scope.Escape(Nan::New((static_cast<CacheableBooleanPtr>(valuePtr))->value()));
     case GeodeTypeIds::CacheableDouble:
@@ -288,6 +808,22 @@ Local<Value> v8Value(const CacheablePtr & valuePtr) {
       return scope.Escape(Nan::New((static_cast<CacheableInt32Ptr>(valuePtr))->value()));
     case GeodeTypeIds::CacheableInt64:
       return scope.Escape(v8Value(static_cast<CacheableInt64Ptr>(valuePtr)));
+    case GeodeTypeIds::CacheableBytes:
+      return scope.Escape(v8Value(static_cast<CacheableBytesPtr>(valuePtr), arrayStorage));
+    case GeodeTypeIds::CacheableInt16Array:
+      return scope.Escape(v8TypedArray<Int16Array>(static_cast<CacheableInt16ArrayPtr>(valuePtr), arrayStorage));
+    case GeodeTypeIds::CacheableInt32Array:
+      return scope.Escape(v8TypedArray<Int32Array>(static_cast<CacheableInt32ArrayPtr>(valuePtr), arrayStorage));
+    case GeodeTypeIds::CacheableFloatArray:
+      return scope.Escape(v8TypedArray<Float32Array>(static_cast<CacheableFloatArrayPtr>(valuePtr), arrayStorage));
+    case GeodeTypeIds::CacheableDoubleArray:
+      return scope.Escape(v8TypedArray<Float64Array>(static_cast<CacheableDoubleArrayPtr>(valuePtr), arrayStorage));
+    case GeodeTypeIds::CacheableInt64Array:
+      return scope.Escape(v8Value(static_cast<CacheableInt64ArrayPtr>(valuePtr), arrayStorage));
+    case GeodeTypeIds::CharArray:
+      return scope.Escape(v8Value(static_cast<CharArrayPtr>(valuePtr)));
+    case GeodeTypeIds::BooleanArray:
+      return scope.Escape(v8Value(static_cast<BooleanArrayPtr>(valuePtr)));
     case GeodeTypeIds::CacheableDate:
       return scope.Escape(v8Value(static_cast<CacheableDatePtr>(valuePtr)));
     case GeodeTypeIds::CacheableUndefined:
@@ -301,7 +837,7 @@ Local<Value> v8Value(const CacheablePtr & valuePtr) {
     case GeodeTypeIds::CacheableVector:
       return scope.Escape(v8Array(static_cast<CacheableVectorPtr>(valuePtr)));
     case GeodeTypeIds::CacheableHashMap:
-      return scope.Escape(v8Object(static_cast<CacheableHashMapPtr>(valuePtr)));
+      return scope.Escape(v8Value(static_cast<CacheableHashMapPtr>(valuePtr)));
     case GeodeTypeIds::CacheableHashSet:
       return scope.Escape(v8Array(static_cast<CacheableHashSetPtr>(valuePtr)));
     case 0:
@@ -326,6 +862,45 @@ Local<Value> v8Value(const CacheablePtr & valuePtr) {
   return scope.Escape(Nan::Undefined());
 }
 
+template<typename TCacheable, typename TField>
+static CacheablePtr pdxPrimitiveField(const PdxInstancePtr & pdxInstance, const char * fieldName) {
+  TField value;
+  pdxInstance->getField(fieldName, value);
+  return TCacheable::create(value);
+}
+
+CacheablePtr pdxFieldValue(const PdxInstancePtr & pdxInstance, const char * fieldName) {
+  // Primitive fields are written by Java classes and by the integer number mode; they have to be
+  // read with the matching typed getter.
+  switch (pdxInstance->getFieldType(fieldName)) {
+    case PdxFieldTypes::BOOLEAN:
+      return pdxPrimitiveField<CacheableBoolean, bool>(pdxInstance, fieldName);
+    case PdxFieldTypes::BYTE:
+      return pdxPrimitiveField<CacheableInt16, signed char>(pdxInstance, fieldName);
+    case PdxFieldTypes::SHORT:
+      return pdxPrimitiveField<CacheableInt16, int16_t>(pdxInstance, fieldName);
+    case PdxFieldTypes::INT:
+      return pdxPrimitiveField<CacheableInt32, int32_t>(pdxInstance, fieldName);
+    case PdxFieldTypes::LONG:
+      return pdxPrimitiveField<CacheableInt64, int64_t>(pdxInstance, fieldName);
+    case PdxFieldTypes::FLOAT:
+      return pdxPrimitiveField<CacheableFloat, float>(pdxInstance, fieldName);
+    case PdxFieldTypes::DOUBLE:
+      return pdxPrimitiveField<CacheableDouble, double>(pdxInstance, fieldName);
+    case PdxFieldTypes::OBJECT_ARRAY: {
+      CacheableObjectArrayPtr valueArray;
+      pdxInstance->getField(fieldName, valueArray);
+      return valueArray;
+    }
+    default:
+      break;
+  }
+
+  CacheablePtr value;
+  pdxInstance->getField(fieldName, value);
+  return value;
+}
+
 Local<Value> v8Value(const PdxInstancePtr & pdxInstance) {
   Nan::EscapableHandleScope scope;
 
@@ -336,20 +911,14 @@ Local<Value> v8Value(const PdxInstancePtr & pdxInstance) {
       return scope.Escape(Nan::New<Object>());
     }
 
-    Local<Object> v8Object = Nan::New<Object>();
+    PdxShape * shape = pdxShape(gemfireKeys);
+    Local<Object> v8Object = (shape != NULL) ? shape->newInstance() : Nan::New<Object>();
     int length = gemfireKeys->length();
 
     for (int i = 0; i < length; i++) {
       const char * key = gemfireKeys[i]->asChar();
-      CacheablePtr value;
-      if (pdxInstance->getFieldType(key) == apache::geode::client::PdxFieldTypes::OBJECT_ARRAY) {
-        CacheableObjectArrayPtr valueArray;
-        pdxInstance->getField(key, valueArray);
-        value = valueArray;
-      } else {
-        pdxInstance->getField(key, value);
-      }
-      Nan::Set(v8Object, Nan::New(key).ToLocalChecked(),v8Value(value)); 
+      Local<String> v8Key = (shape != NULL) ? shape->v8FieldName(i) : Nan::New(key).ToLocalChecked();
+      Nan::Set(v8Object, v8Key, v8Value(pdxFieldValue(pdxInstance, key)));
     }
 
     return scope.Escape(v8Object);
@@ -361,22 +930,87 @@ Local<Value> v8Value(const PdxInstancePtr & pdxInstance) {
   }
 }
 
-Local<Value> v8Value(const CacheableInt64Ptr & valuePtr) {
-   Nan::EscapableHandleScope scope;
+// Warns at most once per interval, mentioning how many warnings were suppressed in between.
+class RateLimitedWarning {
+ public:
+  RateLimitedWarning(const char * message, uint64_t intervalNanoseconds) :
+    message(message),
+    intervalNanoseconds(intervalNanoseconds),
+    warned(false),
+    lastWarning(0),
+    suppressed(0) {}
+
+  void warn() {
+    uint64_t now = uv_hrtime();
+    if (warned && now - lastWarning < intervalNanoseconds) {
+      suppressed++;
+      return;
+    }
+
+    std::stringstream messageStream;
+    messageStream << message;
+    if (suppressed > 0) {
+      messageStream << " (" << suppressed << " similar warnings suppressed)";
+    }
+
+    warned = true;
+    lastWarning = now;
+    suppressed = 0;
+    ConsoleWarn(messageStream.str().c_str());
+  }
+
+  void reset() {
+    warned = false;
+    suppressed = 0;
+  }
+
+ private:
+  const char * message;
+  uint64_t intervalNanoseconds;
+  bool warned;
+  uint64_t lastWarning;
+  uint64_t suppressed;
+};
+
+static const uint64_t int64WarningInterval = 10 * 1000 * 1000 * 1000ULL;
+
+static RateLimitedWarning tooLargeInt64Warning(
+    "Received 64 bit integer from GemFire greater than Number.MAX_SAFE_INTEGER (2^53 - 1)",
+    int64WarningInterval);
+static RateLimitedWarning tooSmallInt64Warning(
+    "Received 64 bit integer from GemFire less than Number.MIN_SAFE_INTEGER (-1 * 2^53 + 1)",
+    int64WarningInterval);
+
+void resetInt64Warnings() {
+  tooLargeInt64Warning.reset();
+  tooSmallInt64Warning.reset();
+}
+
+Local<Value> v8Int64(int64_t value) {
+  Nan::EscapableHandleScope scope;
+
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+  if (options.int64Mode == INT64_AS_BIGINT) {
+    return scope.Escape(BigInt::New(v8::Isolate::GetCurrent(), value));
+  }
+#endif
 
   static const int64_t maxSafeInteger = pow(2, 53) - 1;
   static const int64_t minSafeInteger = -1 * maxSafeInteger;
 
-  int64_t value = static_cast<CacheableInt64Ptr>(valuePtr)->value();
   if (value > maxSafeInteger) {
-    ConsoleWarn("Received 64 bit integer from GemFire greater than Number.MAX_SAFE_INTEGER (2^53 - 1)");
+    tooLargeInt64Warning.warn();
   } else if (value < minSafeInteger) {
-    ConsoleWarn("Received 64 bit integer from GemFire less than Number.MIN_SAFE_INTEGER (-1 * 2^53 + 1)");
+    tooSmallInt64Warning.warn();
   }
 
   return scope.Escape(Nan::New<Number>(value));
 }
 
+Local<Value> v8Value(const CacheableInt64Ptr & valuePtr) {
+  return v8Int64(valuePtr->value());
+}
+
 Local<Date> v8Value(const CacheableDatePtr & datePtr) {
   Nan::EscapableHandleScope scope;
   double epochMillis = datePtr->milliseconds();
@@ -398,6 +1032,24 @@ Local<Object> v8Value(const StructPtr & structPtr) {
   return scope.Escape(v8Object);
 }
 
+Local<Object> v8Value(const CacheableHashMapPtr & hashMapPtr) {
+  Nan::EscapableHandleScope scope;
+
+  if (options.dictionaryType != DICTIONARIES_AS_MAPS) {
+    return scope.Escape(v8Object(hashMapPtr));
+  }
+
+  Local<Context> context(Nan::GetCurrentContext());
+  Local<Map> v8Map(Map::New(v8::Isolate::GetCurrent()));
+  for (CacheableHashMap::Iterator iterator = hashMapPtr->begin();
+       iterator != hashMapPtr->end();
+       iterator++) {
+    CacheablePtr keyPtr(iterator.first());
+    v8Map->Set(context, v8Value(keyPtr), v8Value(iterator.second())).ToLocalChecked();
+  }
+  return scope.Escape(v8Map);
+}
+
 Local<Object> v8Value(const HashMapOfCacheablePtr & hashMapPtr) {
   return v8Object(hashMapPtr);
 }
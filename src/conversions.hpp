@@ -6,11 +6,19 @@
 #include <geode/PdxInstanceFactory.hpp>
 #include <geode/CacheFactory.hpp>
 #include <string>
+#include <set>
 #include <cstdint>
 #include <sys/time.h>
 
+#if (V8_MAJOR_VERSION >= 7)
+#define NODE_GEMFIRE_HAS_BIGINT 1
+#endif
+
 namespace node_gemfire {
 
+// Narrow ASCII strings at least this long are handed to V8 as external strings instead of copies.
+static const int32_t minExternalStringLength = 1024;
+
 apache::geode::client::CacheablePtr gemfireValue(const v8::Local<v8::Value> & v8Value,
                                          const apache::geode::client::CachePtr & cachePtr);
 apache::geode::client::PdxInstancePtr gemfireValue(const v8::Local<v8::Object> & v8Object,
@@ -18,6 +26,11 @@ apache::geode::client::PdxInstancePtr gemfireValue(const v8::Local<v8::Object> &
 apache::geode::client::CacheableArrayListPtr gemfireValue(const v8::Local<v8::Array> & v8Value,
                                          const apache::geode::client::CachePtr & cachePtr);
 apache::geode::client::CacheableDatePtr gemfireValue(const v8::Local<v8::Date> & v8Value);
+apache::geode::client::CacheableStringPtr gemfireValue(const v8::Local<v8::String> & v8String);
+apache::geode::client::CacheablePtr gemfireValue(const v8::Local<v8::ArrayBufferView> & v8View);
+#ifdef NODE_GEMFIRE_HAS_BIGINT
+apache::geode::client::CacheableInt64Ptr gemfireValue(const v8::Local<v8::BigInt> & v8BigInt);
+#endif
 
 apache::geode::client::CacheableKeyPtr gemfireKey(const v8::Local<v8::Value> & v8Value,
                                           const apache::geode::client::CachePtr & cachePtr);
@@ -26,12 +39,32 @@ apache::geode::client::VectorOfCacheableKeyPtr gemfireKeys(const v8::Local<v8::A
 
 apache::geode::client::HashMapOfCacheablePtr gemfireHashMap(const v8::Local<v8::Object> & v8Object,
                                            const apache::geode::client::CachePtr & cachePtr);
+apache::geode::client::CacheableHashMapPtr gemfireDictionary(const v8::Local<v8::Object> & v8Object,
+                                           const apache::geode::client::CachePtr & cachePtr);
+apache::geode::client::CacheableHashMapPtr gemfireDictionary(const v8::Local<v8::Map> & v8Map,
+                                           const apache::geode::client::CachePtr & cachePtr);
 apache::geode::client::CacheableVectorPtr gemfireVector(const v8::Local<v8::Array> & v8Array,
                                            const apache::geode::client::CachePtr & cachePtr);
 
-v8::Local<v8::Value> v8Value(const apache::geode::client::CacheablePtr & valuePtr);
+// How byte and number arrays become Buffers and typed arrays. COPY_ARRAYS gives JavaScript its own
+// storage. SHARE_ARRAYS wraps the GemFire value's storage, so a write through the Buffer changes
+// the value; only use it for values nothing else holds, such as values read from a PROXY region.
+enum ArrayStorage {
+  COPY_ARRAYS,
+  SHARE_ARRAYS
+};
+
+v8::Local<v8::Value> v8Value(const apache::geode::client::CacheablePtr & valuePtr,
+                             ArrayStorage arrayStorage = COPY_ARRAYS);
 v8::Local<v8::Value> v8Value(const apache::geode::client::CacheableKeyPtr & keyPtr);
 v8::Local<v8::Value> v8Value(const apache::geode::client::CacheableInt64Ptr & valuePtr);
+v8::Local<v8::String> v8Value(const apache::geode::client::CacheableStringPtr & stringPtr);
+v8::Local<v8::Object> v8Value(const apache::geode::client::CacheableBytesPtr & bytesPtr,
+                              ArrayStorage arrayStorage = COPY_ARRAYS);
+v8::Local<v8::Object> v8Value(const apache::geode::client::CacheableInt64ArrayPtr & arrayPtr,
+                              ArrayStorage arrayStorage = COPY_ARRAYS);
+v8::Local<v8::Object> v8Value(const apache::geode::client::CharArrayPtr & arrayPtr);
+v8::Local<v8::Array> v8Value(const apache::geode::client::BooleanArrayPtr & arrayPtr);
 v8::Local<v8::Object> v8Value(const apache::geode::client::StructPtr & structPtr);
 v8::Local<v8::Value> v8Value(const apache::geode::client::PdxInstancePtr & pdxInstancePtr);
 v8::Local<v8::Object> v8Value(const apache::geode::client::SelectResultsPtr & selectResultsPtr);
@@ -43,6 +76,10 @@ v8::Local<v8::Array> v8Value(const apache::geode::client::VectorOfCacheableKeyPt
 v8::Local<v8::Array> v8Value(const apache::geode::client::VectorOfRegionEntry & vectorPtr);
 v8::Local<v8::Date> v8Value(const apache::geode::client::CacheableDatePtr & datePtr);
 v8::Local<v8::Boolean> v8Value(bool value);
+v8::Local<v8::Value> v8Int64(int64_t value);
+
+apache::geode::client::CacheablePtr pdxFieldValue(const apache::geode::client::PdxInstancePtr & pdxInstance,
+                                          const char * fieldName);
 
 template<typename T>
 v8::Local<v8::Array> v8Array(const apache::geode::client::SharedPtr<T> & iterablePtr) {
@@ -82,6 +119,65 @@ v8::Local<v8::Object> v8Object(const apache::geode::client::SharedPtr<T> & hashM
 
 std::string getClassName(const v8::Local<v8::Object> & v8Object);
 
+std::wstring wstringFromV8String(const v8::Local<v8::String> & v8String);
+v8::Local<v8::String> v8StringFromWstring(const std::wstring & wideString);
+v8::Local<v8::String> v8StringFromWchar(const wchar_t * wideString, size_t length);
+
+struct ConversionStats {
+  uint64_t pdxPlanCacheHits;
+  uint64_t pdxPlanCacheMisses;
+  uint64_t pdxPlanCacheSize;
+  uint64_t pdxShapeCacheSize;
+};
+
+const ConversionStats & conversionStats();
+
+enum Int64Mode {
+  INT64_AS_NUMBER,
+  INT64_AS_BIGINT
+};
+
+enum NumberMode {
+  NUMBERS_AS_DOUBLES,
+  NUMBERS_AS_INTEGERS
+};
+
+enum DictionaryType {
+  DICTIONARIES_AS_OBJECTS,
+  DICTIONARIES_AS_MAPS
+};
+
+// Set through cache.setConversionOptions(). The cache is a per-process singleton, so these are too.
+// Only read and written on the event loop.
+struct ConversionOptions {
+  Int64Mode int64Mode;
+  NumberMode numberMode;
+  // Plain objects with at least this many own properties are stored as CacheableHashMap; 0 disables.
+  uint32_t dictionaryKeyCount;
+  // Plain objects whose property names are all integers are stored as CacheableHashMap.
+  bool dictionaryIntegerKeys;
+  // What CacheableHashMap values are read back as.
+  DictionaryType dictionaryType;
+  // With NUMBERS_AS_INTEGERS, numeric PDX fields with these names are written as long fields and
+  // every other numeric PDX field as a double field, whatever the value.
+  std::set<std::string> longFields;
+};
+
+ConversionOptions & conversionOptions();
+
+// Lets the next unsafe 64 bit integer warn right away, as after cache.setConversionOptions().
+void resetInt64Warnings();
+
+enum NumberKind {
+  DOUBLE_NUMBER,
+  INT32_NUMBER,
+  INT64_NUMBER
+};
+
+// With NUMBERS_AS_INTEGERS, integral numbers in the int32 range are INT32_NUMBER and other safe
+// integers INT64_NUMBER. Everything else, and every number with NUMBERS_AS_DOUBLES, is DOUBLE_NUMBER.
+NumberKind numberKind(const v8::Local<v8::Value> & v8Value);
+
 }  // namespace node_gemfire
 
 #endif
@@ -0,0 +1,320 @@
+#include <nan.h>
+#include <v8.h>
+#include <geode/GeodeCppCache.hpp>
+#include <cstring>
+#include "decoded_value.hpp"
+#include "conversions.hpp"
+#include "string_transcoding.hpp"
+
+using namespace v8;
+using namespace apache::geode::client;
+
+namespace node_gemfire {
+
+DecodedValue::Node & DecodedValue::addNode(Tag tag, uint32_t length) {
+  nodes.push_back(Node());
+  Node & node(nodes.back());
+  node.tag = tag;
+  node.length = length;
+  node.offset = 0;
+  return node;
+}
+
+void DecodedValue::addString(const char * value) {
+  size_t length = strlen(value);
+  Node & node(addNode(isAscii(value, length) ? ONE_BYTE_STRING_NODE : UTF8_STRING_NODE, length));
+  node.offset = oneByteData.size();
+  oneByteData.append(value, length);
+}
+
+void DecodedValue::shareArraysFrom(const RegionPtr & regionPtr) {
+  if (!regionPtr->getAttributes()->getCachingEnabled()) {
+    arrayStorage = SHARE_ARRAYS;
+  }
+}
+
+void DecodedValue::retain(const CacheablePtr & valuePtr) {
+  Node & node(addNode(RETAINED_NODE));
+  node.offset = retainedValues.size();
+  retainedValues.push_back(valuePtr);
+  sharedRetainedValues.push_back(false);
+}
+
+void DecodedValue::decodeString(const CacheableStringPtr & stringPtr) {
+  int32_t length = stringPtr->length();
+
+  if (stringPtr->isWideString()) {
+    Node & node(addNode(TWO_BYTE_STRING_NODE, length));
+    node.offset = twoByteData.size();
+    twoByteData.resize(twoByteData.size() + length);
+    narrowToUtf16(stringPtr->asWChar(), twoByteData.data() + node.offset, length);
+    return;
+  }
+
+  // Long ASCII strings become external strings over the GemFire value, which costs nothing to
+  // create on the event loop, so there is no point copying them here.
+  const char * data = stringPtr->asChar();
+  if (length >= minExternalStringLength) {
+    retain(stringPtr);
+    return;
+  }
+
+  Node & node(addNode(isAscii(data, length) ? ONE_BYTE_STRING_NODE : UTF8_STRING_NODE, length));
+  node.offset = oneByteData.size();
+  oneByteData.append(data, length);
+}
+
+void DecodedValue::decodePdx(const PdxInstancePtr & pdxInstancePtr) {
+  CacheableStringArrayPtr gemfireKeys(pdxInstancePtr->getFieldNames());
+
+  if (gemfireKeys == NULLPTR) {
+    addNode(OBJECT_NODE, 0);
+    return;
+  }
+
+  int length = gemfireKeys->length();
+  PdxShape * shape = pdxShape(gemfireKeys);
+  if (shape != NULL) {
+    addNode(PDX_OBJECT_NODE, length).shape = shape;
+  } else {
+    addNode(OBJECT_NODE, length);
+  }
+
+  for (int i = 0; i < length; i++) {
+    const char * key = gemfireKeys[i]->asChar();
+    if (shape == NULL) {
+      addString(key);
+    }
+    decode(pdxFieldValue(pdxInstancePtr, key));
+  }
+}
+
+void DecodedValue::decodeStruct(const StructPtr & structPtr) {
+  unsigned int length = structPtr->length();
+  addNode(OBJECT_NODE, length);
+
+  for (unsigned int i = 0; i < length; i++) {
+    addString(structPtr->getFieldName(i));
+    decode((*structPtr)[i]);
+  }
+}
+
+template<typename T>
+void DecodedValue::decodeArray(const SharedPtr<T> & iterablePtr) {
+  addNode(ARRAY_NODE, iterablePtr->size());
+
+  for (typename T::Iterator iterator(iterablePtr->begin());
+       iterator != iterablePtr->end();
+       ++iterator) {
+    decode(static_cast<CacheablePtr>(*iterator));
+  }
+}
+
+template<typename T>
+void DecodedValue::decodeObject(const SharedPtr<T> & hashMapPtr, Tag tag) {
+  addNode(tag, hashMapPtr->size());
+
+  for (typename T::Iterator iterator = hashMapPtr->begin();
+       iterator != hashMapPtr->end();
+       iterator++) {
+    decode(static_cast<CacheablePtr>(iterator.first()));
+    decode(static_cast<CacheablePtr>(iterator.second()));
+  }
+}
+
+void DecodedValue::decode(const CacheablePtr & valuePtr) {
+  if (valuePtr == NULLPTR) {
+    addNode(NULL_NODE);
+    return;
+  }
+
+  int typeId = valuePtr->typeId();
+  switch (typeId) {
+    case GeodeTypeIds::CacheableASCIIString:
+    case GeodeTypeIds::CacheableASCIIStringHuge:
+    case GeodeTypeIds::CacheableString:
+    case GeodeTypeIds::CacheableStringHuge:
+      decodeString(static_cast<CacheableStringPtr>(valuePtr));
+      return;
+    case GeodeTypeIds::CacheableBoolean:
+      addNode(BOOLEAN_NODE).boolean = (static_cast<CacheableBooleanPtr>(valuePtr))->value();
+      return;
+    case GeodeTypeIds::CacheableDouble:
+      addNode(NUMBER_NODE).number = (static_cast<CacheableDoublePtr>(valuePtr))->value();
+      return;
+    case GeodeTypeIds::CacheableFloat:
+      addNode(NUMBER_NODE).number = (static_cast<CacheableFloatPtr>(valuePtr))->value();
+      return;
+    case GeodeTypeIds::CacheableInt16:
+      addNode(NUMBER_NODE).number = (static_cast<CacheableInt16Ptr>(valuePtr))->value();
+      return;
+    case GeodeTypeIds::CacheableInt32:
+      addNode(NUMBER_NODE).number = (static_cast<CacheableInt32Ptr>(valuePtr))->value();
+      return;
+    case GeodeTypeIds::CacheableInt64:
+      addNode(INT64_NODE).int64 = (static_cast<CacheableInt64Ptr>(valuePtr))->value();
+      return;
+    case GeodeTypeIds::CacheableDate:
+      addNode(DATE_NODE).number = (static_cast<CacheableDatePtr>(valuePtr))->milliseconds();
+      return;
+    case GeodeTypeIds::CacheableUndefined:
+      addNode(UNDEFINED_NODE);
+      return;
+    case GeodeTypeIds::Struct:
+      decodeStruct(static_cast<StructPtr>(valuePtr));
+      return;
+    case GeodeTypeIds::CacheableObjectArray:
+      decodeArray(static_cast<CacheableObjectArrayPtr>(valuePtr));
+      return;
+    case GeodeTypeIds::CacheableArrayList:
+      decodeArray(static_cast<CacheableArrayListPtr>(valuePtr));
+      return;
+    case GeodeTypeIds::CacheableVector:
+      decodeArray(static_cast<CacheableVectorPtr>(valuePtr));
+      return;
+    case GeodeTypeIds::CacheableHashMap:
+      decodeObject(static_cast<CacheableHashMapPtr>(valuePtr), DICTIONARY_NODE);
+      return;
+    case GeodeTypeIds::CacheableHashSet:
+      decodeArray(static_cast<CacheableHashSetPtr>(valuePtr));
+      return;
+  }
+
+  if (typeId > GeodeTypeIds::CacheableStringHuge) {
+    // We are assuming these are Pdx
+    decodePdx(static_cast<PdxInstancePtr>(valuePtr));
+    return;
+  }
+
+  // Buffers, typed arrays, function exceptions and unknown types are left to v8Value().
+  retain(valuePtr);
+}
+
+void DecodedValue::decode(const HashMapOfCacheablePtr & hashMapPtr) {
+  decodeObject(hashMapPtr);
+}
+
+void DecodedValue::decode(const VectorOfCacheableKeyPtr & vectorPtr) {
+  decodeArray(vectorPtr);
+}
+
+void DecodedValue::decode(const VectorOfCacheablePtr & vectorPtr) {
+  decodeArray(vectorPtr);
+}
+
+void DecodedValue::decode(const VectorOfRegionEntry & regionEntries) {
+  decode(regionEntries, 0, regionEntries.size());
+}
+
+template<typename T>
+void DecodedValue::decodeRange(const T & vector, size_t begin, size_t end) {
+  addNode(ARRAY_NODE, end - begin);
+
+  for (size_t i = begin; i < end; i++) {
+    decode(static_cast<CacheablePtr>(vector[i]));
+  }
+}
+
+void DecodedValue::decode(const VectorOfCacheableKey & vector, size_t begin, size_t end) {
+  decodeRange(vector, begin, end);
+}
+
+void DecodedValue::decode(const VectorOfCacheable & vector, size_t begin, size_t end) {
+  decodeRange(vector, begin, end);
+}
+
+void DecodedValue::decode(const VectorOfRegionEntry & regionEntries, size_t begin, size_t end) {
+  addNode(ARRAY_NODE, end - begin);
+
+  for (size_t i = begin; i < end; i++) {
+    addNode(OBJECT_NODE, 2);
+    addString("key");
+    decode(static_cast<CacheablePtr>(regionEntries[i]->getKey()));
+    addString("value");
+    decode(regionEntries[i]->getValue());
+  }
+}
+
+Local<Value> DecodedValue::v8Value() {
+  return v8Value(0);
+}
+
+Local<Value> DecodedValue::v8Value(size_t root) {
+  Nan::EscapableHandleScope scope;
+
+  size_t index = root;
+  return scope.Escape(v8Node(index));
+}
+
+Local<Value> DecodedValue::v8Node(size_t & index) {
+  Nan::EscapableHandleScope scope;
+
+  const Node & node(nodes[index++]);
+  switch (node.tag) {
+    case NULL_NODE:
+      return scope.Escape(Nan::Null());
+    case UNDEFINED_NODE:
+      return scope.Escape(Nan::Undefined());
+    case BOOLEAN_NODE:
+      return scope.Escape(Nan::New(node.boolean));
+    case NUMBER_NODE:
+      return scope.Escape(Nan::New(node.number));
+    case INT64_NODE:
+      return scope.Escape(v8Int64(node.int64));
+    case DATE_NODE:
+      return scope.Escape(Nan::New<Date>(node.number).ToLocalChecked());
+    case ONE_BYTE_STRING_NODE:
+      return scope.Escape(Nan::NewOneByteString(
+            reinterpret_cast<const uint8_t *>(oneByteData.data() + node.offset), node.length).ToLocalChecked());
+    case UTF8_STRING_NODE:
+      return scope.Escape(Nan::New(oneByteData.data() + node.offset, node.length).ToLocalChecked());
+    case TWO_BYTE_STRING_NODE:
+      return scope.Escape(Nan::New(twoByteData.data() + node.offset, node.length).ToLocalChecked());
+    case ARRAY_NODE: {
+      Local<Array> v8Array(Nan::New<Array>(node.length));
+      for (uint32_t i = 0; i < node.length; i++) {
+        Nan::Set(v8Array, i, v8Node(index));
+      }
+      return scope.Escape(v8Array);
+    }
+    case DICTIONARY_NODE:
+      if (conversionOptions().dictionaryType == DICTIONARIES_AS_MAPS) {
+        Local<Context> context(Nan::GetCurrentContext());
+        Local<Map> v8Map(Map::New(v8::Isolate::GetCurrent()));
+        for (uint32_t i = 0; i < node.length; i++) {
+          Local<Value> key(v8Node(index));
+          v8Map->Set(context, key, v8Node(index)).ToLocalChecked();
+        }
+        return scope.Escape(v8Map);
+      }
+      // fall through
+    case OBJECT_NODE: {
+      Local<Object> v8Object(Nan::New<Object>());
+      for (uint32_t i = 0; i < node.length; i++) {
+        Local<Value> key(v8Node(index));
+        Nan::Set(v8Object, key, v8Node(index));
+      }
+      return scope.Escape(v8Object);
+    }
+    case PDX_OBJECT_NODE: {
+      Local<Object> v8Object(node.shape->newInstance());
+      for (uint32_t i = 0; i < node.length; i++) {
+        Nan::Set(v8Object, node.shape->v8FieldName(i), v8Node(index));
+      }
+      return scope.Escape(v8Object);
+    }
+    case RETAINED_NODE: {
+      // A root converted more than once, as for batched gets of the same key, must not give two
+      // callers the same storage, so only the first conversion may share it.
+      ArrayStorage storage(sharedRetainedValues[node.offset] ? COPY_ARRAYS : arrayStorage);
+      if (storage == SHARE_ARRAYS) {
+        sharedRetainedValues[node.offset] = true;
+      }
+      return scope.Escape(node_gemfire::v8Value(retainedValues[node.offset], storage));
+    }
+  }
+
+  return scope.Escape(Nan::Undefined());
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,109 @@
+#ifndef __DECODED_VALUE_HPP__
+#define __DECODED_VALUE_HPP__
+
+#include <v8.h>
+#include <geode/GeodeCppCache.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "conversions.hpp"
+#include "pdx_shapes.hpp"
+
+namespace node_gemfire {
+
+// A GemFire value flattened into plain native data, so that PDX field extraction and string
+// transcoding can happen in ExecuteGemfireWork() and the event loop only allocates V8 objects.
+//
+// Nodes are stored in pre-order: an array node is followed by its elements, an object node by
+// alternating keys and values and a PDX object node by its field values, in PdxShape order. String
+// data lives in two shared buffers. Values that are cheaper to convert on the event loop (Buffers
+// and typed arrays, which copy or wrap native memory, long strings, which become external strings,
+// and function exceptions) are retained as-is and converted with v8Value().
+class DecodedValue {
+ public:
+  DecodedValue() : arrayStorage(COPY_ARRAYS) {}
+
+  // Lets Buffers and typed arrays wrap the decoded storage instead of copying it when the values
+  // come from a region without local entries. Otherwise the storage belongs to a cached entry, and
+  // a write through the Buffer would change it for every later reader.
+  void shareArraysFrom(const apache::geode::client::RegionPtr & regionPtr);
+
+  // Called from a worker thread.
+  void decode(const apache::geode::client::CacheablePtr & valuePtr);
+  void decode(const apache::geode::client::HashMapOfCacheablePtr & hashMapPtr);
+  void decode(const apache::geode::client::VectorOfCacheableKeyPtr & vectorPtr);
+  void decode(const apache::geode::client::VectorOfCacheablePtr & vectorPtr);
+  void decode(const apache::geode::client::VectorOfRegionEntry & regionEntries);
+
+  // Decode elements [begin, end) as an array.
+  void decode(const apache::geode::client::VectorOfCacheableKey & vector, size_t begin, size_t end);
+  void decode(const apache::geode::client::VectorOfCacheable & vector, size_t begin, size_t end);
+  void decode(const apache::geode::client::VectorOfRegionEntry & regionEntries, size_t begin, size_t end);
+
+  // Several values can be decoded one after another; position() before each decode() marks the
+  // root to pass to v8Value().
+  size_t position() const { return nodes.size(); }
+
+  // Called from the event loop, once decoding is complete.
+  v8::Local<v8::Value> v8Value();
+  v8::Local<v8::Value> v8Value(size_t root);
+
+ private:
+  enum Tag {
+    NULL_NODE,
+    UNDEFINED_NODE,
+    BOOLEAN_NODE,
+    NUMBER_NODE,
+    INT64_NODE,
+    DATE_NODE,
+    ONE_BYTE_STRING_NODE,
+    UTF8_STRING_NODE,
+    TWO_BYTE_STRING_NODE,
+    ARRAY_NODE,
+    OBJECT_NODE,
+    DICTIONARY_NODE,
+    PDX_OBJECT_NODE,
+    RETAINED_NODE
+  };
+
+  struct Node {
+    Tag tag;
+    uint32_t length;
+    union {
+      bool boolean;
+      double number;
+      int64_t int64;
+      size_t offset;
+      PdxShape * shape;
+    };
+  };
+
+  Node & addNode(Tag tag, uint32_t length = 0);
+  void addString(const char * value);
+  void decodeString(const apache::geode::client::CacheableStringPtr & stringPtr);
+  void decodePdx(const apache::geode::client::PdxInstancePtr & pdxInstancePtr);
+  void decodeStruct(const apache::geode::client::StructPtr & structPtr);
+  void retain(const apache::geode::client::CacheablePtr & valuePtr);
+
+  template<typename T>
+  void decodeArray(const apache::geode::client::SharedPtr<T> & iterablePtr);
+
+  template<typename T>
+  void decodeRange(const T & vector, size_t begin, size_t end);
+  template<typename T>
+  void decodeObject(const apache::geode::client::SharedPtr<T> & hashMapPtr, Tag tag = OBJECT_NODE);
+
+  v8::Local<v8::Value> v8Node(size_t & index);
+
+  std::vector<Node> nodes;
+  std::string oneByteData;
+  std::vector<uint16_t> twoByteData;
+  std::vector<apache::geode::client::CacheablePtr> retainedValues;
+  // Whether a retained value's storage has been handed to JavaScript without a copy.
+  std::vector<bool> sharedRetainedValues;
+  ArrayStorage arrayStorage;
+};
+
+}  // namespace node_gemfire
+
+#endif
@@ -1,5 +1,6 @@
 #include "event_stream.hpp"
 #include <nan.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include "conversions.hpp"
@@ -9,34 +10,224 @@ using namespace apache::geode::client;
 
 namespace node_gemfire {
 
-void EventStream::add(Event * event) {
+void EventStream::add(const std::string & eventName, const EntryEvent & event, Conflation conflation) {
+  if (conflation == NO_CONFLATION && capacity.load(std::memory_order_relaxed) == 0) {
+    pushedEvents.fetch_add(1, std::memory_order_relaxed);
+    Event * unlockedEvent(new Event(eventName, event));
+    unlockedEvent->sequence = nextSequence.fetch_add(1);
+    if (unlockedEvents.push(unlockedEvent)) {
+      // nextEvents() drains under the mutex, so the handle is only referenced while it has not yet
+      // taken this event.
+      uv_mutex_lock(&mutex);
+      if (!unlockedEvents.empty()) {
+        uv_ref(reinterpret_cast<uv_handle_t *>(&async));
+      }
+      uv_mutex_unlock(&mutex);
+      uv_async_send(&async);
+    }
+    return;
+  }
+
   uv_mutex_lock(&mutex);
+  queuedEvents++;
+
+  if (overflow == BLOCK_PRODUCER) {
+    waitForSpace();
+  }
+
+  bool indexed = (conflation != NO_CONFLATION || overflow == CONFLATE_ON_OVERFLOW) &&
+                 event.getKey() != NULLPTR;
+  PendingKey pendingKey;
+
+  if (indexed) {
+    pendingKey.region = event.getRegion().ptr();
+    pendingKey.keyPtr = event.getKey();
+
+    PendingIndexes::iterator pending(pendingIndexes.find(pendingKey));
+    if (pending != pendingIndexes.end() &&
+        (conflation != NO_CONFLATION || (overflow == CONFLATE_ON_OVERFLOW && full()))) {
+      Event * pendingEvent(eventVector[pending->second]);
+      if (pendingEvent->merge(eventName, event, conflation != CONFLATE_LATEST_OLD_VALUE)) {
+        conflatedEvents++;
+        uv_mutex_unlock(&mutex);
+        return;
+      }
+    }
+  }
 
-  eventVector.push_back(event);
+  if (full()) {
+    if (overflow == DROP_NEWEST) {
+      droppedEvents++;
+      uv_mutex_unlock(&mutex);
+      return;
+    }
+
+    // A full stream that blocks producers only gets here on the loop thread, and then grows past
+    // its capacity.
+    if (overflow != BLOCK_PRODUCER) {
+      dropOldest();
+    }
+  }
+
+  if (indexed) {
+    pendingIndexes[pendingKey] = eventVector.size();
+  }
+
+  Event * lockedEvent(new Event(eventName, event));
+  lockedEvent->sequence = nextSequence.fetch_add(1);
+  eventVector.push_back(lockedEvent);
+  highWaterMark = std::max(highWaterMark, depth());
   uv_ref(reinterpret_cast<uv_handle_t *>(&async));
   uv_mutex_unlock(&mutex);
 
   uv_async_send(&async);
 }
 
-std::vector<EventStream::Event *> EventStream::nextEvents() {
+EventStream::Event * EventStream::nextEvents() {
+  std::vector<Event *> lockedEvents;
   uv_mutex_lock(&mutex);
 
-  std::vector<Event *> returnValue;
+  size_t drained;
+  Event * unlocked(unlockedEvents.drain(drained));
 
-  for (std::vector<Event *>::iterator iterator(eventVector.begin());
-       iterator != eventVector.end();
-       ++iterator) {
-    Event * event(*iterator);
-    returnValue.push_back(event);
-  }
+  size_t first = oldestEvent;
+  highWaterMark = std::max(highWaterMark, drained + depth());
+  drainedEvents += drained;
 
-  eventVector.clear();
+  lockedEvents.swap(eventVector);
+  pendingIndexes.clear();
+  oldestEvent = 0;
+  droppedSlots = 0;
 
   uv_unref(reinterpret_cast<uv_handle_t *>(&async));
+  uv_cond_broadcast(&spaceCond);
   uv_mutex_unlock(&mutex);
 
-  return returnValue;
+  // Unconflated regions use the lock-free queue while conflated regions, or every region under a
+  // capacity, use the vector, so both usually hold events. Merge them back into the order they
+  // were added in, which each queue already keeps for the events of any one GemFire thread.
+  Event * events = NULL;
+  Event ** tail = &events;
+  size_t i = first;
+  while (unlocked != NULL || i < lockedEvents.size()) {
+    if (i < lockedEvents.size() && lockedEvents[i] == NULL) {
+      i++;
+      continue;
+    }
+
+    Event * event;
+    if (unlocked != NULL && (i == lockedEvents.size() || unlocked->sequence < lockedEvents[i]->sequence)) {
+      event = unlocked;
+      unlocked = unlocked->next;
+    } else {
+      event = lockedEvents[i++];
+    }
+
+    *tail = event;
+    tail = &event->next;
+  }
+  *tail = NULL;
+
+  return events;
+}
+
+EventStream::Stats EventStream::stats() {
+  uv_mutex_lock(&mutex);
+  Stats stats;
+  uint64_t pushed = pushedEvents.load(std::memory_order_relaxed);
+  stats.queuedEvents = queuedEvents + pushed;
+  stats.conflatedEvents = conflatedEvents;
+  stats.droppedEvents = droppedEvents;
+  stats.blockedEvents = blockedEvents;
+  stats.pendingEvents = depth() + static_cast<size_t>(pushed - drainedEvents);
+  stats.highWaterMark = highWaterMark;
+  stats.capacity = capacity;
+  stats.overflow = overflow;
+  uv_mutex_unlock(&mutex);
+  return stats;
+}
+
+void EventStream::setCapacity(size_t newCapacity, Overflow newOverflow) {
+  uv_mutex_lock(&mutex);
+  capacity = newCapacity;
+  overflow = newOverflow;
+
+  // Producers blocked on the old capacity recheck the new one, or stop waiting if the stream no
+  // longer blocks.
+  uv_cond_broadcast(&spaceCond);
+  uv_mutex_unlock(&mutex);
+}
+
+size_t EventStream::depth() const {
+  return eventVector.size() - droppedSlots;
+}
+
+bool EventStream::full() const {
+  return capacity > 0 && depth() >= capacity;
+}
+
+void EventStream::waitForSpace() {
+  uv_thread_t currentThread(uv_thread_self());
+  if (!full() || uv_thread_equal(&loopThread, &currentThread)) {
+    return;
+  }
+
+  blockedEvents++;
+  while (full() && overflow == BLOCK_PRODUCER) {
+    uv_cond_wait(&spaceCond, &mutex);
+  }
+}
+
+void EventStream::dropOldest() {
+  while (eventVector[oldestEvent] == NULL) {
+    oldestEvent++;
+  }
+
+  Event *& oldest(eventVector[oldestEvent]);
+
+  PendingKey pendingKey;
+  pendingKey.region = oldest->getRegion().ptr();
+  pendingKey.keyPtr = oldest->getKey();
+  if (pendingKey.keyPtr != NULLPTR) {
+    PendingIndexes::iterator pending(pendingIndexes.find(pendingKey));
+    if (pending != pendingIndexes.end() && pending->second == oldestEvent) {
+      pendingIndexes.erase(pending);
+    }
+  }
+
+  delete oldest;
+  oldest = NULL;
+  oldestEvent++;
+  droppedSlots++;
+  droppedEvents++;
+  compact();
+}
+
+// Removes the NULL slots once they outnumber the waiting events, so a loop thread that is held up
+// for a long time does not let eventVector grow with every dropped event.
+void EventStream::compact() {
+  if (droppedSlots < 1024 || droppedSlots < depth()) {
+    return;
+  }
+
+  std::vector<size_t> newIndexes(eventVector.size());
+  std::vector<Event *>::iterator compacted(eventVector.begin());
+  for (size_t i = 0; i < eventVector.size(); i++) {
+    if (eventVector[i] != NULL) {
+      newIndexes[i] = compacted - eventVector.begin();
+      *compacted++ = eventVector[i];
+    }
+  }
+  eventVector.erase(compacted, eventVector.end());
+
+  for (PendingIndexes::iterator pending(pendingIndexes.begin());
+       pending != pendingIndexes.end();
+       ++pending) {
+    pending->second = newIndexes[pending->second];
+  }
+
+  oldestEvent = 0;
+  droppedSlots = 0;
 }
 
 Local<Object> EventStream::Event::v8Object() {
@@ -59,4 +250,25 @@ apache::geode::client::RegionPtr EventStream::Event::getRegion() {
   return entryEventPtr->getRegion();
 }
 
+CacheableKeyPtr EventStream::Event::getKey() {
+  return entryEventPtr->getKey();
+}
+
+bool EventStream::Event::merge(const std::string & laterEventName,
+                               const EntryEvent & laterEvent,
+                               bool keepOldValue) {
+  if (laterEventName != eventName) {
+    return false;
+  }
+
+  CacheablePtr oldValuePtr(keepOldValue ? entryEventPtr->getOldValue() : laterEvent.getOldValue());
+  entryEventPtr = new EntryEvent(laterEvent.getRegion(),
+                                 laterEvent.getKey(),
+                                 oldValuePtr,
+                                 laterEvent.getNewValue(),
+                                 laterEvent.getCallbackArgument(),
+                                 laterEvent.remoteOrigin());
+  return true;
+}
+
 }  // namespace node_gemfire
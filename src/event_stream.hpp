@@ -10,16 +10,61 @@
 #include <vector>
 #include <cassert>
 #include <string>
+#include <unordered_map>
+#include <atomic>
+#include "mpsc_queue.hpp"
 
 namespace node_gemfire {
 
 class EventStream: public apache::geode::client::SharedBase {
  public:
+  // With conflation, an event for a key that already has an event waiting to be published is
+  // merged into the waiting one, so the loop converts one payload per key however many changes
+  // it missed.
+  enum Conflation {
+    NO_CONFLATION,
+    CONFLATE_KEEP_OLD_VALUE,
+    CONFLATE_LATEST_OLD_VALUE
+  };
+
+  // What add() does with an event while capacity events are waiting to be published.
+  enum Overflow {
+    BLOCK_PRODUCER,
+    DROP_OLDEST,
+    DROP_NEWEST,
+    CONFLATE_ON_OVERFLOW
+  };
+
+  struct Stats {
+    uint64_t queuedEvents;
+    uint64_t conflatedEvents;
+    uint64_t droppedEvents;
+    uint64_t blockedEvents;
+    size_t pendingEvents;
+    size_t highWaterMark;
+    size_t capacity;
+    Overflow overflow;
+  };
+
   explicit EventStream(
       void * target,
       uv_async_cb callback) :
-    SharedBase() {
+    SharedBase(),
+    loopThread(uv_thread_self()),
+    capacity(0),
+    overflow(BLOCK_PRODUCER),
+    nextSequence(0),
+    pushedEvents(0),
+    drainedEvents(0),
+    oldestEvent(0),
+    droppedSlots(0),
+    queuedEvents(0),
+    conflatedEvents(0),
+    droppedEvents(0),
+    blockedEvents(0),
+    highWaterMark(0) {
       uv_mutex_init(&mutex);
+      uv_cond_init(&spaceCond);
       async.data = target;
       uv_mutex_lock(&mutex);
       uv_async_init(uv_default_loop(), &async, callback);
@@ -29,6 +74,7 @@ class EventStream: public apache::geode::client::SharedBase {
 
   virtual ~EventStream() {
     uv_close(reinterpret_cast<uv_handle_t *>(&async), NULL);
+    uv_cond_destroy(&spaceCond);
     uv_mutex_destroy(&mutex);
   }
 
@@ -42,29 +88,104 @@ class EventStream: public apache::geode::client::SharedBase {
                                             event.getOldValue(),
                                             event.getNewValue(),
                                             event.getCallbackArgument(),
-                                            event.remoteOrigin())) {}
+                                            event.remoteOrigin())),
+      sequence(0),
+      next(NULL) {}
 
     v8::Local<v8::Object> v8Object();
     std::string getName();
     apache::geode::client::RegionPtr getRegion();
+    apache::geode::client::CacheableKeyPtr getKey();
+
+    // Folds a later event of the same type for the same key into this one. Returns false, leaving
+    // this event unchanged, for an event of another type: it is published separately, so that
+    // listeners for either type still see their event.
+    bool merge(const std::string & laterEventName,
+               const apache::geode::client::EntryEvent & laterEvent,
+               bool keepOldValue);
+
+    // The order in which the event was added to the stream, across both of its queues. An event
+    // that others were merged into keeps its own sequence.
+    uint64_t sequence;
+
+    // Links the events taken by nextEvents(), and the events in the lock-free queue.
+    Event * next;
 
    private:
     std::string eventName;
     apache::geode::client::EntryEventPtr entryEventPtr;
   };
 
-  void add(Event * event);
-  std::vector<Event *> nextEvents();
+  void add(const std::string & eventName,
+           const apache::geode::client::EntryEvent & event,
+           Conflation conflation);
+  // Takes the events waiting to be published, oldest first, as a list linked through Event::next.
+  // The caller deletes them.
+  Event * nextEvents();
+  Stats stats();
+
+  // Limits the number of events waiting to be published; 0 means no limit.
+  void setCapacity(size_t capacity, Overflow overflow);
 
  private:
+  struct PendingKey {
+    apache::geode::client::Region * region;
+    apache::geode::client::CacheableKeyPtr keyPtr;
+  };
+
+  struct PendingKeyHash {
+    size_t operator()(const PendingKey & pendingKey) const {
+      return reinterpret_cast<size_t>(pendingKey.region) ^ pendingKey.keyPtr->hashcode();
+    }
+  };
+
+  struct PendingKeyEqual {
+    bool operator()(const PendingKey & first, const PendingKey & second) const {
+      return first.region == second.region && *first.keyPtr == *second.keyPtr;
+    }
+  };
+
+  typedef std::unordered_map<PendingKey, size_t, PendingKeyHash, PendingKeyEqual> PendingIndexes;
+
   static void teardownCallback(uv_work_t * request);
   static void afterTeardownCallback(uv_work_t * request, int status);
   void teardown();
 
+  size_t depth() const;
+  bool full() const;
+  void waitForSpace();
+  void dropOldest();
+  void compact();
+
   uv_mutex_t mutex;
+  uv_cond_t spaceCond;
   uv_async_t async;
 
+  // Events raised on the loop thread, as by region.putSync(), are never blocked: nothing would
+  // publish the waiting events.
+  uv_thread_t loopThread;
+  std::atomic<size_t> capacity;
+  Overflow overflow;
+
+  // Events that are neither conflated nor counted against a capacity skip the mutex: they are
+  // pushed onto this queue, and the loop swaps it out.
+  MpscQueue<Event> unlockedEvents;
+  std::atomic<uint64_t> nextSequence;
+  std::atomic<uint64_t> pushedEvents;
+  uint64_t drainedEvents;
+
   std::vector<Event *> eventVector;
+
+  // Positions in eventVector of the conflatable events waiting to be published. A slot is set to
+  // NULL when its event is dropped; oldestEvent is the first slot that may not be.
+  PendingIndexes pendingIndexes;
+  size_t oldestEvent;
+  size_t droppedSlots;
+  uint64_t queuedEvents;
+  uint64_t conflatedEvents;
+  uint64_t droppedEvents;
+  uint64_t blockedEvents;
+  size_t highWaterMark;
 };
 
 }  // namespace node_gemfire
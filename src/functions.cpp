@@ -9,13 +9,14 @@
 #include "exceptions.hpp"
 #include "events.hpp"
 #include "streaming_result_collector.hpp"
+#include "thread_pool.hpp"
 
 using namespace v8;
 using namespace apache::geode::client;
 
 namespace node_gemfire {
 
-class ExecuteFunctionWorker {
+class ExecuteFunctionWorker : public ThreadPool::Task {
  public:
   ExecuteFunctionWorker(
       const ExecutionPtr & executionPtr,
@@ -34,7 +35,6 @@ class ExecuteFunctionWorker {
     ended(false),
     executeCompleted(false) {
       emitter.Reset(emitterHandle);
-      request.data = reinterpret_cast<void *>(this);
     }
 
   ~ExecuteFunctionWorker() {
@@ -42,14 +42,12 @@ class ExecuteFunctionWorker {
     delete resultStream;
   }
 
-  static void Execute(uv_work_t * request) {
-    ExecuteFunctionWorker * worker = static_cast<ExecuteFunctionWorker *>(request->data);
-    worker->Execute();
+  void execute() {
+    Execute();
   }
 
-  static void ExecuteComplete(uv_work_t * request, int status) {
-    ExecuteFunctionWorker * worker = static_cast<ExecuteFunctionWorker *>(request->data);
-    worker->ExecuteComplete();
+  void complete() {
+    ExecuteComplete();
   }
 
   static void DataAsyncCallback(uv_async_t * async, int status) {
@@ -98,11 +96,9 @@ class ExecuteFunctionWorker {
 
     Local<Object> eventEmitter(Nan::New(emitter));
 
-    CacheableVectorPtr resultsPtr(resultStream->nextResults());
-    for (CacheableVector::Iterator iterator(resultsPtr->begin());
-         iterator != resultsPtr->end();
-         ++iterator) {
-      Local<Value> result(v8Value(*iterator));
+    ResultStream::Result * results(resultStream->nextResults());
+    for (ResultStream::Result * iterator(results); iterator != NULL; iterator = iterator->next) {
+      Local<Value> result(v8Value(iterator->resultPtr));
 
       if (result->IsNativeError()) {
         emitError(eventEmitter, result);
@@ -111,6 +107,7 @@ class ExecuteFunctionWorker {
       }
     }
 
+    ResultStream::deleteResults(results);
     resultStream->resultsProcessed();
   }
 
@@ -129,8 +126,6 @@ class ExecuteFunctionWorker {
     }
   }
 
-  uv_work_t request;
-
  private:
   ResultStream * resultStream;
 
@@ -238,11 +233,7 @@ Local<Value> executeFunction(Nan::NAN_METHOD_ARGS_TYPE info,
     ExecuteFunctionWorker * worker =
       new ExecuteFunctionWorker(executionPtr, functionName, functionArguments, functionFilter, eventEmitter);
 
-    uv_queue_work(
-        uv_default_loop(),
-        &worker->request,
-        ExecuteFunctionWorker::Execute,
-        ExecuteFunctionWorker::ExecuteComplete);
+    ThreadPool::getInstance().queue(worker, ThreadPool::BULK_LANE);
 
     return scope.Escape(eventEmitter);
   }
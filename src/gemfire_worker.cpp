@@ -5,6 +5,7 @@
 #include <unistd.h>
 #include "gemfire_worker.hpp"
 #include "exceptions.hpp"
+#include "thread_pool.hpp"
 
 using namespace v8;
 
@@ -34,4 +35,60 @@ void GemfireWorker::Execute() {
     Nan::Set(err, Nan::New("name").ToLocalChecked(), Nan::New(errorName).ToLocalChecked());
     return scope.Escape(err);
   }
+
+class AsyncWorkerTask : public ThreadPool::Task {
+ public:
+  explicit AsyncWorkerTask(Nan::AsyncWorker * worker) :
+    worker(worker) {}
+
+  void execute() {
+    worker->Execute();
+  }
+
+  void complete() {
+    worker->WorkComplete();
+    worker->Destroy();
+    delete this;
+  }
+
+ private:
+  Nan::AsyncWorker * worker;
+};
+
+void queueGemfireWorker(Nan::AsyncWorker * worker, ThreadPool::Lane lane) {
+  ThreadPool::getInstance().queue(new AsyncWorkerTask(worker), lane);
+}
+
+void queueGemfireWorker(Nan::AsyncWorker * worker,
+                        ThreadPool::Lane lane,
+                        const apache::geode::client::CacheableKeyPtr & keyPtr) {
+  if (keyPtr == NULLPTR) {
+    queueGemfireWorker(worker, lane);
+    return;
+  }
+  ThreadPool::getInstance().queue(new AsyncWorkerTask(worker), lane, static_cast<uint32_t>(keyPtr->hashcode()));
+}
+
+bool laneOption(const Local<Value> & options, ThreadPool::Lane & lane) {
+  if (!options->IsObject() || options->IsFunction()) {
+    return true;
+  }
+
+  Local<Value> laneValue(options->ToObject()->Get(Nan::New("lane").ToLocalChecked()));
+  if (laneValue->IsUndefined()) {
+    return true;
+  }
+
+  std::string laneName(*Nan::Utf8String(laneValue));
+  if (laneName == "point") {
+    lane = ThreadPool::POINT_LANE;
+  } else if (laneName == "bulk") {
+    lane = ThreadPool::BULK_LANE;
+  } else {
+    Nan::ThrowError("lane must be \"point\" or \"bulk\".");
+    return false;
+  }
+  return true;
+}
+
 }  // namespace node_gemfire
@@ -4,6 +4,7 @@
 #include <nan.h>
 #include <geode/GeodeCppCache.hpp>
 #include <string>
+#include "thread_pool.hpp"
 
 namespace node_gemfire {
 
@@ -23,6 +24,19 @@ class GemfireWorker : public Nan::AsyncWorker {
     std::string errorName;
 };
 
+// Queues a worker on the GemFire thread pool. Used in place of Nan::AsyncQueueWorker().
+void queueGemfireWorker(Nan::AsyncWorker * worker, ThreadPool::Lane lane);
+
+// Queues a worker that runs after the workers previously queued this way for an equal key. A null
+// key queues the worker unordered.
+void queueGemfireWorker(Nan::AsyncWorker * worker,
+                        ThreadPool::Lane lane,
+                        const apache::geode::client::CacheableKeyPtr & keyPtr);
+
+// Reads the `lane` option ("point" or "bulk") of an asynchronous operation into lane, leaving it
+// unchanged when the option is absent. Throws and returns false for any other value.
+bool laneOption(const v8::Local<v8::Value> & options, ThreadPool::Lane & lane);
+
 }  // namespace node_gemfire
 
 #endif
@@ -0,0 +1,116 @@
+#include "get_batcher.hpp"
+#include <geode/GeodeCppCache.hpp>
+#include <vector>
+#include "decoded_value.hpp"
+#include "gemfire_worker.hpp"
+
+using namespace v8;
+using namespace apache::geode::client;
+
+namespace node_gemfire {
+
+class BatchedGetWorker : public GemfireWorker {
+ public:
+  BatchedGetWorker(
+      const RegionPtr & regionPtr,
+      const VectorOfCacheableKeyPtr & keysPtr,
+      const std::vector<GetBatcher::Get> & gets) :
+    GemfireWorker(NULL),
+    regionPtr(regionPtr),
+    keysPtr(keysPtr),
+    gets(gets) {}
+
+  ~BatchedGetWorker() {
+    for (std::vector<GetBatcher::Get>::iterator iterator(gets.begin());
+         iterator != gets.end();
+         ++iterator) {
+      delete iterator->callback;
+    }
+  }
+
+  void ExecuteGemfireWork() {
+    HashMapOfCacheablePtr resultsPtr(new HashMapOfCacheable());
+    // Caches the fetched values locally, as regionPtr->get does for a single key.
+    regionPtr->getAll(*keysPtr, resultsPtr, NULLPTR, true);
+
+    // Every key is decoded into the same DecodedValue; roots[i] is where the value of key i starts.
+    decodedValue.shareArraysFrom(regionPtr);
+    roots.reserve(keysPtr->size());
+    for (VectorOfCacheableKey::Iterator iterator(keysPtr->begin());
+         iterator != keysPtr->end();
+         ++iterator) {
+      roots.push_back(decodedValue.position());
+      HashMapOfCacheable::Iterator result(resultsPtr->find(*iterator));
+      decodedValue.decode(result == resultsPtr->end() ? CacheablePtr() : result.second());
+    }
+  }
+
+  void HandleOKCallback() {
+    Nan::HandleScope scope;
+    for (std::vector<GetBatcher::Get>::iterator iterator(gets.begin());
+         iterator != gets.end();
+         ++iterator) {
+      Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value(roots[iterator->keyIndex]) };
+      Nan::Call(*iterator->callback, 2, argv);
+    }
+  }
+
+  void HandleErrorCallback() {
+    Nan::HandleScope scope;
+    for (std::vector<GetBatcher::Get>::iterator iterator(gets.begin());
+         iterator != gets.end();
+         ++iterator) {
+      Local<Value> argv[1] = { errorObject() };
+      Nan::Call(*iterator->callback, 1, argv);
+    }
+  }
+
+ private:
+  RegionPtr regionPtr;
+  VectorOfCacheableKeyPtr keysPtr;
+  std::vector<GetBatcher::Get> gets;
+  DecodedValue decodedValue;
+  std::vector<size_t> roots;
+};
+
+GetBatcher::GetBatcher(const RegionPtr & regionPtr, uint32_t maxBatchSize) :
+    LoopBatcher(0),
+    regionPtr(regionPtr),
+    maxGets(maxBatchSize > 0 ? maxBatchSize : 1) {}
+
+void GetBatcher::add(const CacheableKeyPtr & keyPtr, Nan::Callback * callback) {
+  if (!isBatchOpen()) {
+    keysPtr = new VectorOfCacheableKey();
+    openBatch();
+  }
+
+  Get get;
+  get.callback = callback;
+
+  std::unordered_map<CacheableKeyPtr, size_t, KeyHash, KeyEqual>::iterator
+    existing(keyIndexes.find(keyPtr));
+  if (existing != keyIndexes.end()) {
+    get.keyIndex = existing->second;
+  } else {
+    get.keyIndex = keysPtr->size();
+    keyIndexes[keyPtr] = get.keyIndex;
+    keysPtr->push_back(keyPtr);
+  }
+  gets.push_back(get);
+
+  if (gets.size() >= maxGets) {
+    flush();
+  }
+}
+
+void GetBatcher::sendBatch() {
+  BatchedGetWorker * worker = new BatchedGetWorker(regionPtr, keysPtr, gets);
+
+  keysPtr = NULLPTR;
+  keyIndexes.clear();
+  gets.clear();
+
+  queueGemfireWorker(worker, ThreadPool::POINT_LANE);
+}
+
+}  // namespace node_gemfire
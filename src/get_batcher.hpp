@@ -0,0 +1,53 @@
+#ifndef __GET_BATCHER_HPP__
+#define __GET_BATCHER_HPP__
+
+#include <v8.h>
+#include <nan.h>
+#include <geode/GeodeCppCache.hpp>
+#include <unordered_map>
+#include <vector>
+#include "loop_batcher.hpp"
+
+namespace node_gemfire {
+
+// Merges the region.get() calls made in one event loop turn into a single getAll(). Each distinct
+// key is fetched once and its value is handed to every caller that asked for it.
+class GetBatcher : public LoopBatcher {
+ public:
+  GetBatcher(const apache::geode::client::RegionPtr & regionPtr, uint32_t maxBatchSize);
+
+  void add(const apache::geode::client::CacheableKeyPtr & keyPtr, Nan::Callback * callback);
+
+  struct Get {
+    size_t keyIndex;
+    Nan::Callback * callback;
+  };
+
+ protected:
+  void sendBatch();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const apache::geode::client::CacheableKeyPtr & keyPtr) const {
+      return keyPtr->hashcode();
+    }
+  };
+
+  struct KeyEqual {
+    bool operator()(const apache::geode::client::CacheableKeyPtr & first,
+                    const apache::geode::client::CacheableKeyPtr & second) const {
+      return *first == *second;
+    }
+  };
+
+  apache::geode::client::RegionPtr regionPtr;
+  uint32_t maxGets;
+
+  apache::geode::client::VectorOfCacheableKeyPtr keysPtr;
+  std::unordered_map<apache::geode::client::CacheableKeyPtr, size_t, KeyHash, KeyEqual> keyIndexes;
+  std::vector<Get> gets;
+};
+
+}  // namespace node_gemfire
+
+#endif
@@ -0,0 +1,64 @@
+#include "loop_batcher.hpp"
+#include <uv.h>
+
+namespace node_gemfire {
+
+LoopBatcher::LoopBatcher(uint64_t windowMicros) :
+    windowNanos(windowMicros * 1000),
+    batchStart(0),
+    batchOpen(false),
+    openHandles(2) {
+  uv_check_init(uv_default_loop(), &check);
+  uv_timer_init(uv_default_loop(), &timer);
+  check.data = this;
+  timer.data = this;
+}
+
+void LoopBatcher::openBatch() {
+  batchOpen = true;
+  batchStart = uv_hrtime();
+
+  // The check handle sends the batch at the end of the loop turn once the window has elapsed;
+  // the timer, rounded up to libuv's millisecond resolution, keeps the loop from blocking in
+  // poll until then.
+  uv_check_start(&check, checkCallback);
+  uv_timer_start(&timer, timerCallback, (windowNanos + 999999) / 1000000, 0);
+}
+
+void LoopBatcher::flush() {
+  if (!batchOpen) {
+    return;
+  }
+
+  uv_check_stop(&check);
+  uv_timer_stop(&timer);
+  batchOpen = false;
+
+  sendBatch();
+}
+
+void LoopBatcher::close() {
+  flush();
+  uv_close(reinterpret_cast<uv_handle_t *>(&check), closeCallback);
+  uv_close(reinterpret_cast<uv_handle_t *>(&timer), closeCallback);
+}
+
+void LoopBatcher::checkCallback(uv_check_t * check) {
+  LoopBatcher * batcher = static_cast<LoopBatcher *>(check->data);
+  if (uv_hrtime() - batcher->batchStart >= batcher->windowNanos) {
+    batcher->flush();
+  }
+}
+
+void LoopBatcher::timerCallback(uv_timer_t * timer) {
+  static_cast<LoopBatcher *>(timer->data)->flush();
+}
+
+void LoopBatcher::closeCallback(uv_handle_t * handle) {
+  LoopBatcher * batcher = static_cast<LoopBatcher *>(handle->data);
+  if (--batcher->openHandles == 0) {
+    delete batcher;
+  }
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,45 @@
+#ifndef __LOOP_BATCHER_HPP__
+#define __LOOP_BATCHER_HPP__
+
+#include <uv.h>
+
+namespace node_gemfire {
+
+// Base class for batching requests made on the event loop. The first request of a batch calls
+// openBatch(); the batch is sent with sendBatch() at the end of the first loop turn after the
+// window has elapsed, or earlier through flush().
+class LoopBatcher {
+ public:
+  explicit LoopBatcher(uint64_t windowMicros);
+
+  void flush();
+
+  // Sends any pending batch and frees the batcher once libuv has released its handles.
+  void close();
+
+  uint64_t windowMicros() const { return windowNanos / 1000; }
+
+ protected:
+  virtual ~LoopBatcher() {}
+
+  void openBatch();
+  bool isBatchOpen() const { return batchOpen; }
+  virtual void sendBatch() = 0;
+
+ private:
+  static void checkCallback(uv_check_t * check);
+  static void timerCallback(uv_timer_t * timer);
+  static void closeCallback(uv_handle_t * handle);
+
+  uint64_t windowNanos;
+  uint64_t batchStart;
+  bool batchOpen;
+
+  uv_check_t check;
+  uv_timer_t timer;
+  int openHandles;
+};
+
+}  // namespace node_gemfire
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef __MPSC_QUEUE_HPP__
+#define __MPSC_QUEUE_HPP__
+
+#include <atomic>
+#include <cstddef>
+
+namespace node_gemfire {
+
+// An intrusive multi-producer, single-consumer queue. Producers on any thread push nodes with one
+// compare-and-swap and never wait for each other or for the consumer; the consumer takes every
+// queued node at once by swapping the list out. TNode must have a `TNode * next` member, which the
+// queue owns while the node is queued.
+template<typename TNode>
+class MpscQueue {
+ public:
+  MpscQueue() : head(NULL) {}
+
+  // Returns true if the queue was empty, so that only the producer that made it non-empty needs
+  // to wake the consumer.
+  bool push(TNode * node) {
+    TNode * oldHead(head.load(std::memory_order_relaxed));
+    do {
+      node->next = oldHead;
+    } while (!head.compare_exchange_weak(oldHead, node,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+    return oldHead == NULL;
+  }
+
+  // Takes all queued nodes, oldest first, as a list linked through `next`. Sets count to the
+  // number of nodes taken. Only one thread may drain.
+  TNode * drain(size_t & count) {
+    TNode * node(head.exchange(NULL, std::memory_order_acquire));
+
+    // Nodes are pushed onto the front of the list, so reverse it to restore the push order.
+    TNode * oldest = NULL;
+    count = 0;
+    while (node != NULL) {
+      TNode * next(node->next);
+      node->next = oldest;
+      oldest = node;
+      node = next;
+      count++;
+    }
+    return oldest;
+  }
+
+  bool empty() const {
+    return head.load(std::memory_order_acquire) == NULL;
+  }
+
+ private:
+  MpscQueue(const MpscQueue &);
+  MpscQueue & operator=(const MpscQueue &);
+
+  std::atomic<TNode *> head;
+};
+
+}  // namespace node_gemfire
+
+#endif
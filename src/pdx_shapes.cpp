@@ -0,0 +1,132 @@
+#include "pdx_shapes.hpp"
+#include <uv.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace v8;
+using namespace apache::geode::client;
+
+namespace node_gemfire {
+
+static const size_t maxPdxShapes = 1024;
+
+class PdxShapeCache {
+ public:
+  PdxShapeCache() {
+    uv_mutex_init(&mutex);
+  }
+
+  ~PdxShapeCache() {
+    uv_mutex_destroy(&mutex);
+  }
+
+  PdxShape * find(const std::string & key, const std::vector<std::string> & fieldNames) {
+    uv_mutex_lock(&mutex);
+
+    PdxShape * shape = NULL;
+    std::unordered_map< std::string, std::unique_ptr<PdxShape> >::const_iterator iterator(shapes.find(key));
+    if (iterator != shapes.end()) {
+      shape = iterator->second.get();
+    } else if (shapes.size() < maxPdxShapes) {
+      shape = new PdxShape(fieldNames);
+      shapes[key].reset(shape);
+    }
+
+    uv_mutex_unlock(&mutex);
+    return shape;
+  }
+
+  size_t size() {
+    uv_mutex_lock(&mutex);
+    size_t size = shapes.size();
+    uv_mutex_unlock(&mutex);
+    return size;
+  }
+
+ private:
+  uv_mutex_t mutex;
+  std::unordered_map< std::string, std::unique_ptr<PdxShape> > shapes;
+};
+
+static PdxShapeCache & pdxShapeCache() {
+  static PdxShapeCache cache;
+  return cache;
+}
+
+// Integer-like names are elements rather than named properties, which a template cannot declare.
+static bool isArrayIndex(const char * name) {
+  if (*name == '\0') {
+    return false;
+  }
+  for (const char * c = name; *c != '\0'; c++) {
+    if (*c < '0' || *c > '9') {
+      return false;
+    }
+  }
+  return true;
+}
+
+PdxShape * pdxShape(const CacheableStringArrayPtr & gemfireKeys) {
+  int length = gemfireKeys->length();
+
+  std::string key;
+  std::vector<std::string> fieldNames;
+  fieldNames.reserve(length);
+  for (int i = 0; i < length; i++) {
+    const char * fieldName = gemfireKeys[i]->asChar();
+    if (isArrayIndex(fieldName)) {
+      return NULL;
+    }
+
+    fieldNames.push_back(fieldName);
+    key.append(fieldNames.back());
+    key += '\0';
+  }
+
+  return pdxShapeCache().find(key, fieldNames);
+}
+
+size_t pdxShapeCount() {
+  return pdxShapeCache().size();
+}
+
+void PdxShape::initializeTemplate() {
+  Nan::HandleScope scope;
+
+  Isolate * isolate = Isolate::GetCurrent();
+  Local<ObjectTemplate> v8Template(Nan::New<ObjectTemplate>());
+
+  v8FieldNames.reserve(fieldNames.size());
+  for (std::vector<std::string>::const_iterator iterator(fieldNames.begin());
+       iterator != fieldNames.end();
+       ++iterator) {
+    Local<String> v8FieldName(
+        String::NewFromUtf8(isolate, iterator->c_str(), NewStringType::kInternalized).ToLocalChecked());
+    v8FieldNames.push_back(new Nan::Persistent<String>(v8FieldName));
+    Nan::SetTemplate(v8Template, v8FieldName, Nan::Undefined());
+  }
+
+  objectTemplate.Reset(v8Template);
+}
+
+Local<Object> PdxShape::newInstance() {
+  Nan::EscapableHandleScope scope;
+
+  if (objectTemplate.IsEmpty()) {
+    initializeTemplate();
+  }
+
+  return scope.Escape(Nan::NewInstance(Nan::New(objectTemplate)).ToLocalChecked());
+}
+
+Local<String> PdxShape::v8FieldName(size_t index) {
+  if (objectTemplate.IsEmpty()) {
+    initializeTemplate();
+  }
+
+  return Nan::New(*v8FieldNames[index]);
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,50 @@
+#ifndef __PDX_SHAPES_HPP__
+#define __PDX_SHAPES_HPP__
+
+#include <nan.h>
+#include <v8.h>
+#include <geode/GeodeCppCache.hpp>
+#include <string>
+#include <vector>
+
+namespace node_gemfire {
+
+// The field names of a PDX type, in the order getFieldNames() returns them. Every result object of
+// a shape is created from the same ObjectTemplate with all of its fields already present, so they
+// share one hidden class and filling in the values never transitions it.
+//
+// Shapes are interned and never freed, so pointers to them may be kept across threads. The V8
+// handles are created lazily and only used on the event loop.
+class PdxShape {
+ public:
+  explicit PdxShape(const std::vector<std::string> & fieldNames) :
+    fieldNames(fieldNames) {}
+
+  size_t length() const {
+    return fieldNames.size();
+  }
+
+  const char * fieldName(size_t index) const {
+    return fieldNames[index].c_str();
+  }
+
+  v8::Local<v8::Object> newInstance();
+  v8::Local<v8::String> v8FieldName(size_t index);
+
+ private:
+  void initializeTemplate();
+
+  std::vector<std::string> fieldNames;
+  std::vector< Nan::Persistent<v8::String> * > v8FieldNames;
+  Nan::Persistent<v8::ObjectTemplate> objectTemplate;
+};
+
+// Returns the interned shape for these field names, or NULL once the cache is full or when a field
+// name cannot be declared on a template. Safe to call from worker threads.
+PdxShape * pdxShape(const apache::geode::client::CacheableStringArrayPtr & fieldNames);
+
+size_t pdxShapeCount();
+
+}  // namespace node_gemfire
+
+#endif
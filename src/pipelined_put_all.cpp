@@ -0,0 +1,241 @@
+#include "pipelined_put_all.hpp"
+#include <geode/GeodeCppCache.hpp>
+#include <algorithm>
+#include "conversions.hpp"
+#include "events.hpp"
+#include "gemfire_worker.hpp"
+
+using namespace v8;
+using namespace apache::geode::client;
+
+namespace node_gemfire {
+
+class PutAllChunkWorker : public GemfireWorker {
+ public:
+  PutAllChunkWorker(
+      PipelinedPutAll * putAll,
+      const RegionPtr & regionPtr,
+      const HashMapOfCacheablePtr & hashMapPtr,
+      uint32_t chunk,
+      uint32_t entryCount) :
+    GemfireWorker(NULL),
+    putAll(putAll),
+    regionPtr(regionPtr),
+    hashMapPtr(hashMapPtr),
+    chunk(chunk),
+    entryCount(entryCount) {}
+
+  void ExecuteGemfireWork() {
+    if (hashMapPtr == NULLPTR) {
+      SetError("InvalidValueError", "Invalid GemFire value.");
+      return;
+    }
+    regionPtr->putAll(*hashMapPtr);
+  }
+
+  void HandleOKCallback() {
+    Nan::HandleScope scope;
+    putAll->chunkStored(chunk, entryCount, Nan::Undefined());
+  }
+
+  void HandleErrorCallback() {
+    Nan::HandleScope scope;
+    putAll->chunkStored(chunk, entryCount, errorObject());
+  }
+
+ private:
+  PipelinedPutAll * putAll;
+  RegionPtr regionPtr;
+  HashMapOfCacheablePtr hashMapPtr;
+  uint32_t chunk;
+  uint32_t entryCount;
+};
+
+void PipelinedPutAll::start(const Local<Object> & regionObject,
+                            const RegionPtr & regionPtr,
+                            const CachePtr & cachePtr,
+                            const Local<Object> & entries,
+                            uint32_t chunkSize,
+                            uint32_t maxInFlight,
+                            ThreadPool::Lane lane,
+                            Nan::Callback * progressCallback,
+                            Nan::Callback * callback) {
+  new PipelinedPutAll(regionObject, regionPtr, cachePtr, entries, chunkSize, maxInFlight, lane,
+                      progressCallback, callback);
+}
+
+PipelinedPutAll::PipelinedPutAll(const Local<Object> & v8RegionObject,
+                                 const RegionPtr & regionPtr,
+                                 const CachePtr & cachePtr,
+                                 const Local<Object> & v8Entries,
+                                 uint32_t chunkSize,
+                                 uint32_t maxInFlight,
+                                 ThreadPool::Lane lane,
+                                 Nan::Callback * progressCallback,
+                                 Nan::Callback * callback) :
+    regionPtr(regionPtr),
+    cachePtr(cachePtr),
+    chunkSize(chunkSize),
+    maxInFlight(maxInFlight),
+    lane(lane),
+    progressCallback(progressCallback),
+    callback(callback),
+    convertedEntries(0),
+    storedEntries(0),
+    chunksSent(0),
+    chunksInFlight(0),
+    failedChunks(0) {
+  Local<Array> v8Keys(v8Entries->GetOwnPropertyNames());
+  totalEntries = v8Keys->Length();
+
+  regionObject.Reset(v8RegionObject);
+  entries.Reset(v8Entries);
+  keys.Reset(v8Keys);
+
+  // The first chunk is converted on the next loop turn, so the callbacks are never called before
+  // putAll() returns.
+  uv_idle_init(uv_default_loop(), &idle);
+  idle.data = this;
+  uv_idle_start(&idle, idleCallback);
+}
+
+PipelinedPutAll::~PipelinedPutAll() {
+  regionObject.Reset();
+  entries.Reset();
+  keys.Reset();
+  firstError.Reset();
+  delete progressCallback;
+  delete callback;
+}
+
+void PipelinedPutAll::idleCallback(uv_idle_t * idle) {
+  PipelinedPutAll * putAll = static_cast<PipelinedPutAll *>(idle->data);
+
+  if (putAll->convertedEntries < putAll->totalEntries &&
+      putAll->chunksInFlight < putAll->maxInFlight) {
+    putAll->convertChunk();
+  }
+
+  if (putAll->convertedEntries >= putAll->totalEntries ||
+      putAll->chunksInFlight >= putAll->maxInFlight) {
+    uv_idle_stop(idle);
+  }
+
+  if (putAll->convertedEntries >= putAll->totalEntries && putAll->chunksInFlight == 0) {
+    putAll->finish();
+  }
+}
+
+void PipelinedPutAll::convertChunk() {
+  Nan::HandleScope scope;
+
+  Local<Object> v8Entries(Nan::New(entries));
+  Local<Array> v8Keys(Nan::New(keys));
+
+  uint32_t chunk = chunksSent++;
+  uint32_t begin = convertedEntries;
+  uint32_t end = std::min(begin + chunkSize, totalEntries);
+  convertedEntries = end;
+
+  HashMapOfCacheablePtr hashMapPtr(new HashMapOfCacheable());
+  Local<Value> conversionError;
+
+  {
+    Nan::TryCatch tryCatch;
+    for (uint32_t i = begin; i < end; i++) {
+      Local<String> v8Key(v8Keys->Get(i)->ToString());
+
+      CacheableKeyPtr keyPtr(gemfireKey(v8Key, cachePtr));
+      CacheablePtr valuePtr(gemfireValue(v8Entries->Get(v8Key), cachePtr));
+
+      if (tryCatch.HasCaught()) {
+        conversionError = tryCatch.Exception();
+        break;
+      }
+
+      if (valuePtr == NULLPTR) {
+        hashMapPtr = NULLPTR;
+        break;
+      }
+
+      hashMapPtr->insert(keyPtr, valuePtr);
+    }
+  }
+
+  // A chunk that could not be converted is reported here; idleCallback() carries on with the rest.
+  if (!conversionError.IsEmpty()) {
+    report(chunk, end - begin, conversionError);
+    return;
+  }
+
+  chunksInFlight++;
+  PutAllChunkWorker * worker = new PutAllChunkWorker(this, regionPtr, hashMapPtr, chunk, end - begin);
+  queueGemfireWorker(worker, lane);
+}
+
+void PipelinedPutAll::chunkStored(uint32_t chunk, uint32_t entryCount, const Local<Value> & error) {
+  chunksInFlight--;
+  report(chunk, entryCount, error);
+
+  if (convertedEntries < totalEntries) {
+    uv_idle_start(&idle, idleCallback);
+  } else if (chunksInFlight == 0) {
+    finish();
+  }
+}
+
+void PipelinedPutAll::report(uint32_t chunk, uint32_t entryCount, const Local<Value> & error) {
+  Nan::HandleScope scope;
+
+  if (error->IsUndefined()) {
+    storedEntries += entryCount;
+  } else {
+    failedChunks++;
+    if (firstError.IsEmpty()) {
+      firstError.Reset(error);
+    }
+  }
+
+  if (progressCallback != NULL) {
+    Local<Value> argv[2] = { error, progress(chunk, entryCount) };
+    Nan::Call(*progressCallback, 2, argv);
+  }
+}
+
+void PipelinedPutAll::finish() {
+  Nan::HandleScope scope;
+
+  if (callback != NULL) {
+    Local<Value> error(firstError.IsEmpty() ? Nan::Undefined().As<Value>() : Nan::New(firstError));
+    Local<Object> summary(Nan::New<Object>());
+    Nan::Set(summary, Nan::New("totalEntries").ToLocalChecked(), Nan::New(totalEntries));
+    Nan::Set(summary, Nan::New("storedEntries").ToLocalChecked(), Nan::New(storedEntries));
+    Nan::Set(summary, Nan::New("failedChunks").ToLocalChecked(), Nan::New(failedChunks));
+
+    Local<Value> argv[2] = { error, summary };
+    Nan::Call(*callback, 2, argv);
+  } else if (!firstError.IsEmpty()) {
+    emitError(Nan::New(regionObject), Nan::New(firstError));
+  }
+
+  uv_close(reinterpret_cast<uv_handle_t *>(&idle), closeCallback);
+}
+
+Local<Object> PipelinedPutAll::progress(uint32_t chunk, uint32_t entryCount) {
+  Nan::EscapableHandleScope scope;
+
+  Local<Object> progress(Nan::New<Object>());
+  Nan::Set(progress, Nan::New("chunk").ToLocalChecked(), Nan::New(chunk));
+  Nan::Set(progress, Nan::New("entries").ToLocalChecked(), Nan::New(entryCount));
+  Nan::Set(progress, Nan::New("storedEntries").ToLocalChecked(), Nan::New(storedEntries));
+  Nan::Set(progress, Nan::New("totalEntries").ToLocalChecked(), Nan::New(totalEntries));
+  Nan::Set(progress, Nan::New("failedChunks").ToLocalChecked(), Nan::New(failedChunks));
+
+  return scope.Escape(progress);
+}
+
+void PipelinedPutAll::closeCallback(uv_handle_t * handle) {
+  delete static_cast<PipelinedPutAll *>(handle->data);
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,77 @@
+#ifndef __PIPELINED_PUT_ALL_HPP__
+#define __PIPELINED_PUT_ALL_HPP__
+
+#include <v8.h>
+#include <nan.h>
+#include <uv.h>
+#include <geode/GeodeCppCache.hpp>
+#include "thread_pool.hpp"
+
+namespace node_gemfire {
+
+// Stores a large object with one putAll() per chunk of chunkSize entries. One chunk is converted
+// per event loop turn, and each converted chunk is stored on the thread pool while the next one is
+// converted; at most maxInFlight chunks are converted but not yet stored. A chunk that fails does
+// not stop the others. Frees itself after the final callback.
+class PipelinedPutAll {
+ public:
+  static void start(const v8::Local<v8::Object> & regionObject,
+                    const apache::geode::client::RegionPtr & regionPtr,
+                    const apache::geode::client::CachePtr & cachePtr,
+                    const v8::Local<v8::Object> & entries,
+                    uint32_t chunkSize,
+                    uint32_t maxInFlight,
+                    ThreadPool::Lane lane,
+                    Nan::Callback * progressCallback,
+                    Nan::Callback * callback);
+
+  // Called on the event loop when the putAll() of a chunk has finished.
+  void chunkStored(uint32_t chunk, uint32_t entryCount, const v8::Local<v8::Value> & error);
+
+  static const uint32_t defaultMaxInFlight = 2;
+
+ private:
+  PipelinedPutAll(const v8::Local<v8::Object> & regionObject,
+                  const apache::geode::client::RegionPtr & regionPtr,
+                  const apache::geode::client::CachePtr & cachePtr,
+                  const v8::Local<v8::Object> & entries,
+                  uint32_t chunkSize,
+                  uint32_t maxInFlight,
+                  ThreadPool::Lane lane,
+                  Nan::Callback * progressCallback,
+                  Nan::Callback * callback);
+  ~PipelinedPutAll();
+
+  void convertChunk();
+  void report(uint32_t chunk, uint32_t entryCount, const v8::Local<v8::Value> & error);
+  void finish();
+  v8::Local<v8::Object> progress(uint32_t chunk, uint32_t entryCount);
+
+  static void idleCallback(uv_idle_t * idle);
+  static void closeCallback(uv_handle_t * handle);
+
+  Nan::Persistent<v8::Object> regionObject;
+  Nan::Persistent<v8::Object> entries;
+  Nan::Persistent<v8::Array> keys;
+  apache::geode::client::RegionPtr regionPtr;
+  apache::geode::client::CachePtr cachePtr;
+  uint32_t chunkSize;
+  uint32_t maxInFlight;
+  ThreadPool::Lane lane;
+  Nan::Callback * progressCallback;
+  Nan::Callback * callback;
+
+  uint32_t totalEntries;
+  uint32_t convertedEntries;
+  uint32_t storedEntries;
+  uint32_t chunksSent;
+  uint32_t chunksInFlight;
+  uint32_t failedChunks;
+  Nan::Persistent<v8::Value> firstError;
+
+  uv_idle_t idle;
+};
+
+}  // namespace node_gemfire
+
+#endif
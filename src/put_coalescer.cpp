@@ -0,0 +1,111 @@
+#include "put_coalescer.hpp"
+#include <geode/GeodeCppCache.hpp>
+#include <vector>
+#include "events.hpp"
+#include "gemfire_worker.hpp"
+
+using namespace v8;
+using namespace apache::geode::client;
+
+namespace node_gemfire {
+
+class CoalescedPutWorker : public GemfireWorker {
+ public:
+  CoalescedPutWorker(
+      const Local<Object> & regionObject,
+      const RegionPtr & regionPtr,
+      const HashMapOfCacheablePtr & hashMapPtr,
+      const std::vector<Nan::Callback *> & callbacks) :
+    GemfireWorker(NULL),
+    regionPtr(regionPtr),
+    hashMapPtr(hashMapPtr),
+    callbacks(callbacks) {
+      SaveToPersistent("regionObject", regionObject);
+    }
+
+  ~CoalescedPutWorker() {
+    for (std::vector<Nan::Callback *>::iterator iterator(callbacks.begin());
+         iterator != callbacks.end();
+         ++iterator) {
+      delete *iterator;
+    }
+  }
+
+  void ExecuteGemfireWork() {
+    regionPtr->putAll(*hashMapPtr);
+  }
+
+  void HandleOKCallback() {
+    Nan::HandleScope scope;
+    for (std::vector<Nan::Callback *>::iterator iterator(callbacks.begin());
+         iterator != callbacks.end();
+         ++iterator) {
+      if (*iterator != NULL) {
+        Nan::Call(**iterator, 0, NULL);
+      }
+    }
+  }
+
+  // Puts without a callback share one error event: they failed together in one putAll.
+  void HandleErrorCallback() {
+    Nan::HandleScope scope;
+    bool emitsError = false;
+    for (std::vector<Nan::Callback *>::iterator iterator(callbacks.begin());
+         iterator != callbacks.end();
+         ++iterator) {
+      if (*iterator != NULL) {
+        Local<Value> argv[1] = { errorObject() };
+        Nan::Call(**iterator, 1, argv);
+      } else {
+        emitsError = true;
+      }
+    }
+
+    if (emitsError) {
+      emitError(GetFromPersistent("regionObject")->ToObject(), errorObject());
+    }
+  }
+
+ private:
+  RegionPtr regionPtr;
+  HashMapOfCacheablePtr hashMapPtr;
+  std::vector<Nan::Callback *> callbacks;
+};
+
+PutCoalescer::PutCoalescer(const RegionPtr & regionPtr, uint64_t windowMicros, uint32_t maxBatchSize) :
+    LoopBatcher(windowMicros),
+    regionPtr(regionPtr),
+    maxPuts(maxBatchSize > 0 ? maxBatchSize : 1) {}
+
+void PutCoalescer::add(const Local<Object> & v8RegionObject,
+                       const CacheableKeyPtr & keyPtr,
+                       const CacheablePtr & valuePtr,
+                       Nan::Callback * callback) {
+  if (!isBatchOpen()) {
+    hashMapPtr = new HashMapOfCacheable();
+    regionObject.Reset(v8RegionObject);
+    openBatch();
+  }
+
+  hashMapPtr->erase(keyPtr);
+  hashMapPtr->insert(keyPtr, valuePtr);
+  callbacks.push_back(callback);
+
+  if (callbacks.size() >= maxPuts) {
+    flush();
+  }
+}
+
+void PutCoalescer::sendBatch() {
+  Nan::HandleScope scope;
+  CoalescedPutWorker * worker =
+    new CoalescedPutWorker(Nan::New(regionObject), regionPtr, hashMapPtr, callbacks);
+
+  hashMapPtr = NULLPTR;
+  callbacks.clear();
+  regionObject.Reset();
+
+  queueGemfireWorker(worker, ThreadPool::POINT_LANE);
+}
+
+}  // namespace node_gemfire
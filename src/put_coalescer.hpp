@@ -0,0 +1,40 @@
+#ifndef __PUT_COALESCER_HPP__
+#define __PUT_COALESCER_HPP__
+
+#include <v8.h>
+#include <nan.h>
+#include <geode/GeodeCppCache.hpp>
+#include <vector>
+#include "loop_batcher.hpp"
+
+namespace node_gemfire {
+
+// Collects region.put() calls into a single putAll() per batch, sent at the end of the event loop
+// turn in which its window elapses or as soon as it holds maxBatchSize puts. Each put keeps its own
+// callback; a later put to a key replaces an earlier one in the same batch.
+class PutCoalescer : public LoopBatcher {
+ public:
+  PutCoalescer(const apache::geode::client::RegionPtr & regionPtr,
+               uint64_t windowMicros,
+               uint32_t maxBatchSize);
+
+  void add(const v8::Local<v8::Object> & regionObject,
+           const apache::geode::client::CacheableKeyPtr & keyPtr,
+           const apache::geode::client::CacheablePtr & valuePtr,
+           Nan::Callback * callback);
+
+ protected:
+  void sendBatch();
+
+ private:
+  apache::geode::client::RegionPtr regionPtr;
+  uint32_t maxPuts;
+
+  apache::geode::client::HashMapOfCacheablePtr hashMapPtr;
+  std::vector<Nan::Callback *> callbacks;
+  Nan::Persistent<v8::Object> regionObject;
+};
+
+}  // namespace node_gemfire
+
+#endif
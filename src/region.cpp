@@ -5,12 +5,16 @@
 #include <string>
 #include <vector>
 #include "conversions.hpp"
+#include "decoded_value.hpp"
 #include "exceptions.hpp"
 #include "cache.hpp"
 #include "gemfire_worker.hpp"
 #include "events.hpp"
 #include "functions.hpp"
+#include "region_event_listener.hpp"
 #include "region_event_registry.hpp"
+#include "pipelined_put_all.hpp"
+#include "region_iterator.hpp"
 #include "dependencies.hpp"
 
 using namespace v8;
@@ -22,6 +26,11 @@ inline bool isFunctionOrUndefined(const Local<Value> & value) {
   return value->IsUndefined() || value->IsFunction();
 }
 
+// Asynchronous operations take an optional options object just before their callback.
+inline bool isOptions(const Local<Value> & value) {
+  return value->IsObject() && !value->IsFunction();
+}
+
 inline Nan::Callback * getCallback(const Local<Value> & value) {
   if (value->IsUndefined()) {
     return NULL;
@@ -29,6 +38,93 @@ inline Nan::Callback * getCallback(const Local<Value> & value) {
   return new Nan::Callback(Local<Function>::Cast(value));
 }
 
+// Reads a positive integer option into value, leaving it unchanged when the option is absent.
+// Throws and returns false for any other value.
+static bool positiveIntegerOption(const Local<Object> & options,
+                                  const char * methodName,
+                                  const char * name,
+                                  uint32_t & value) {
+  Local<Value> v8Value(Nan::Get(options, Nan::New(name).ToLocalChecked()).ToLocalChecked());
+  if (v8Value->IsUndefined()) {
+    return true;
+  }
+
+  if (!v8Value->IsUint32() || Nan::To<uint32_t>(v8Value).FromJust() == 0) {
+    std::stringstream errorMessageStream;
+    errorMessageStream << methodName << ": " << name << " must be a positive integer.";
+    Nan::ThrowError(errorMessageStream.str().c_str());
+    return false;
+  }
+
+  value = Nan::To<uint32_t>(v8Value).FromJust();
+  return true;
+}
+
+// Queues a worker for a single-key operation. With key ordering turned on, it runs after the
+// operations queued before it for the same key.
+static void queueKeyWorker(Region * region,
+                           Nan::AsyncWorker * worker,
+                           ThreadPool::Lane lane,
+                           const CacheableKeyPtr & keyPtr) {
+  if (region->keyOrdering) {
+    queueGemfireWorker(worker, lane, keyPtr);
+  } else {
+    queueGemfireWorker(worker, lane);
+  }
+}
+
+static unsigned int eventType(const Local<Value> & eventName) {
+  if (!eventName->IsString()) {
+    return 0;
+  }
+
+  return RegionEventListener::eventType(*Nan::Utf8String(eventName));
+}
+
+// EventEmitter emits "newListener" before adding a listener and "removeListener" after removing
+// one; both are called with the region as this.
+static NAN_METHOD(CaptureNewListener) {
+  unsigned int type = eventType(info[0]);
+  if (type == 0) {
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.This());
+  if ((region->eventMask & type) == 0) {
+    region->eventMask |= type;
+    RegionEventRegistry::getInstance()->updateCapture(region);
+  }
+}
+
+static NAN_METHOD(CaptureRemovedListener) {
+  Nan::HandleScope scope;
+
+  unsigned int type = eventType(info[0]);
+  if (type == 0) {
+    return;
+  }
+
+  Local<Value> argv[1] = { info[0] };
+  Local<Value> listenerCount(Nan::MakeCallback(info.This(), "listenerCount", 1, argv));
+  if (listenerCount->IsNumber() && Nan::To<uint32_t>(listenerCount).FromJust() > 0) {
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.This());
+  if ((region->eventMask & type) != 0) {
+    region->eventMask &= ~type;
+    RegionEventRegistry::getInstance()->updateCapture(region);
+  }
+}
+
+// Marks the functions above so that lib/binding.js can keep them when listeners are removed.
+static Local<Function> captureListener(Nan::FunctionCallback callback) {
+  Local<Function> function(Nan::GetFunction(Nan::New<FunctionTemplate>(callback)).ToLocalChecked());
+  Nan::DefineOwnProperty(function, Nan::New("gemfireCaptureListener").ToLocalChecked(), Nan::True(),
+      static_cast<PropertyAttribute>(ReadOnly | DontEnum | DontDelete));
+  return function;
+}
+
 v8::Local<v8::Object> Region::NewInstance(RegionPtr regionPtr) {
   Nan::EscapableHandleScope scope;
   const unsigned int argc = 0;
@@ -37,6 +133,16 @@ v8::Local<v8::Object> Region::NewInstance(RegionPtr regionPtr) {
   Region *region = new Region(regionPtr);
   RegionEventRegistry::getInstance()->add(region);
   region->Wrap(instance);
+
+  // The GemFire listener is only installed while there are JavaScript listeners for entry events.
+  static Nan::Persistent<Function> newListener(captureListener(CaptureNewListener));
+  static Nan::Persistent<Function> removeListener(captureListener(CaptureRemovedListener));
+
+  Local<Value> newListenerArgv[2] = { Nan::New("newListener").ToLocalChecked(), Nan::New(newListener) };
+  Nan::MakeCallback(instance, "on", 2, newListenerArgv);
+  Local<Value> removeListenerArgv[2] = { Nan::New("removeListener").ToLocalChecked(), Nan::New(removeListener) };
+  Nan::MakeCallback(instance, "on", 2, removeListenerArgv);
+
   return scope.Escape(instance);
 }
 
@@ -93,7 +199,7 @@ NAN_METHOD(Region::Clear) {
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
   Nan::Callback * callback = getCallback(info[0]);
   ClearWorker * worker = new ClearWorker(info.Holder(), region, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, ThreadPool::BULK_LANE);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -164,11 +270,17 @@ NAN_METHOD(Region::Put) {
     Nan::ThrowError("You must pass a key and value to put().");
     return;
   }
-  if (!isFunctionOrUndefined(info[2])) {
+  int callbackIndex = isOptions(info[2]) ? 3 : 2;
+  if (!isFunctionOrUndefined(info[callbackIndex])) {
     Nan::ThrowError("You must pass a function as the callback to put().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::POINT_LANE);
+  if (!laneOption(info[2], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
 
   CachePtr cachePtr(getCacheFromRegion(region->regionPtr));
@@ -179,9 +291,18 @@ NAN_METHOD(Region::Put) {
   CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
   CacheablePtr valuePtr(gemfireValue(info[1], cachePtr));
 
-  Nan::Callback * callback = getCallback(info[2]);
+  Nan::Callback * callback = getCallback(info[callbackIndex]);
+
+  // Invalid keys and values take the normal path so that they are reported the same way.
+  if (region->putCoalescer != NULL && !region->keyOrdering && lane == ThreadPool::POINT_LANE &&
+      keyPtr != NULLPTR && valuePtr != NULLPTR) {
+    region->putCoalescer->add(info.Holder(), keyPtr, valuePtr, callback);
+    info.GetReturnValue().Set(info.Holder());
+    return;
+  }
+
   PutWorker * putWorker = new PutWorker(info.Holder(), region, keyPtr, valuePtr, callback);
-  Nan::AsyncQueueWorker(putWorker);
+  queueKeyWorker(region, putWorker, lane, keyPtr);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -227,6 +348,54 @@ NAN_METHOD(Region::PutSync) {
   }
 }
 
+NAN_METHOD(Region::SetPutCoalescing) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !(info[0]->IsObject() || info[0]->IsFalse())) {
+    Nan::ThrowError("You must pass an options object or false to setPutCoalescing().");
+    return;
+  }
+
+  uint64_t windowMicros = 0;
+  uint32_t maxBatchSize = 1000;
+
+  if (info[0]->IsObject()) {
+    Local<Object> options(info[0]->ToObject());
+
+    Local<Value> window(options->Get(Nan::New("windowMicros").ToLocalChecked()));
+    if (!window->IsUndefined()) {
+      if (!window->IsNumber() || window->NumberValue() < 0) {
+        Nan::ThrowError("setPutCoalescing: windowMicros must be a non-negative number.");
+        return;
+      }
+      windowMicros = static_cast<uint64_t>(window->NumberValue());
+    }
+
+    Local<Value> maxSize(options->Get(Nan::New("maxBatchSize").ToLocalChecked()));
+    if (!maxSize->IsUndefined()) {
+      if (!maxSize->IsNumber() || maxSize->NumberValue() < 1 ||
+          maxSize->NumberValue() != maxSize->Uint32Value()) {
+        Nan::ThrowError("setPutCoalescing: maxBatchSize must be a positive integer.");
+        return;
+      }
+      maxBatchSize = maxSize->Uint32Value();
+    }
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+
+  if (region->putCoalescer != NULL) {
+    region->putCoalescer->close();
+    region->putCoalescer = NULL;
+  }
+
+  if (info[0]->IsObject()) {
+    region->putCoalescer = new PutCoalescer(region->regionPtr, windowMicros, maxBatchSize);
+  }
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
 class GetWorker : public GemfireWorker {
  public:
   GetWorker(Nan::Callback * callback,
@@ -242,7 +411,8 @@ class GetWorker : public GemfireWorker {
       return;
     }
 
-    valuePtr = regionPtr->get(keyPtr);
+    decodedValue.shareArraysFrom(regionPtr);
+    decodedValue.decode(regionPtr->get(keyPtr));
 
     //TODO switching up behavior no error for key not found
     /*
@@ -254,13 +424,13 @@ class GetWorker : public GemfireWorker {
 
   void HandleOKCallback() {
     Nan::HandleScope scope;
-    Local<Value> argv[2] = { Nan::Undefined(), v8Value(valuePtr) };
+    Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value() };
     Nan::Call(*callback, 2, argv);
   }
 
   RegionPtr regionPtr;
   CacheableKeyPtr keyPtr;
-  CacheablePtr valuePtr;
+  DecodedValue decodedValue;
 };
 
 NAN_METHOD(Region::Get) {
@@ -268,16 +438,22 @@ NAN_METHOD(Region::Get) {
 
   unsigned int argsLength = info.Length();
 
-  if (argsLength != 2) {
+  if (argsLength != 2 && !(argsLength == 3 && isOptions(info[1]))) {
     Nan::ThrowError("You must pass a key and a callback to get().");
     return;
   }
 
-  if (!info[1]->IsFunction()) {
+  int callbackIndex = argsLength - 1;
+  if (!info[callbackIndex]->IsFunction()) {
     Nan::ThrowError("You must pass a function as the callback to get().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::POINT_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
   RegionPtr regionPtr(region->regionPtr);
 
@@ -288,9 +464,17 @@ NAN_METHOD(Region::Get) {
 
   CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
 
-  Nan::Callback * callback = new Nan::Callback(info[1].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
+
+  if (region->getBatcher != NULL && !region->keyOrdering && lane == ThreadPool::POINT_LANE &&
+      keyPtr != NULLPTR) {
+    region->getBatcher->add(keyPtr, callback);
+    info.GetReturnValue().Set(info.Holder());
+    return;
+  }
+
   GetWorker * getWorker = new GetWorker(callback, regionPtr, keyPtr);
-  Nan::AsyncQueueWorker(getWorker);
+  queueKeyWorker(region, getWorker, lane, keyPtr);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -322,6 +506,247 @@ NAN_METHOD(Region::GetSync) {
   info.GetReturnValue().Set(v8Value(valuePtr));
 }
 
+// Converts the key argument of the local-only methods, which run inline on the event loop and
+// never go to the server. Throws and returns NULLPTR when there is no valid key.
+static CacheableKeyPtr localKey(const Nan::FunctionCallbackInfo<Value> & info,
+                                const RegionPtr & regionPtr,
+                                const char * methodName) {
+  if (info.Length() == 0) {
+    std::stringstream errorMessageStream;
+    errorMessageStream << "You must pass a key to " << methodName << "().";
+    Nan::ThrowError(errorMessageStream.str().c_str());
+    return NULLPTR;
+  }
+
+  CachePtr cachePtr(getCacheFromRegion(regionPtr));
+  if (cachePtr == NULLPTR) {
+    return NULLPTR;
+  }
+
+  CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
+  if (keyPtr == NULLPTR) {
+    Nan::ThrowError("Invalid GemFire key.");
+  }
+  return keyPtr;
+}
+
+NAN_METHOD(Region::Peek) {
+  Nan::HandleScope scope;
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  CacheableKeyPtr keyPtr(localKey(info, region->regionPtr, "peek"));
+  if (keyPtr == NULLPTR) {
+    return;
+  }
+
+  try {
+    RegionEntryPtr entryPtr(region->regionPtr->getEntry(keyPtr));
+    info.GetReturnValue().Set(v8Value(entryPtr == NULLPTR ? NULLPTR : entryPtr->getValue()));
+  } catch (const apache::geode::client::Exception & exception) {
+    ThrowGemfireException(exception);
+  }
+}
+
+NAN_METHOD(Region::ContainsKey) {
+  Nan::HandleScope scope;
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  CacheableKeyPtr keyPtr(localKey(info, region->regionPtr, "containsKey"));
+  if (keyPtr == NULLPTR) {
+    return;
+  }
+
+  try {
+    info.GetReturnValue().Set(Nan::New(region->regionPtr->containsKey(keyPtr)));
+  } catch (const apache::geode::client::Exception & exception) {
+    ThrowGemfireException(exception);
+  }
+}
+
+NAN_METHOD(Region::ContainsValueForKey) {
+  Nan::HandleScope scope;
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  CacheableKeyPtr keyPtr(localKey(info, region->regionPtr, "containsValueForKey"));
+  if (keyPtr == NULLPTR) {
+    return;
+  }
+
+  try {
+    info.GetReturnValue().Set(Nan::New(region->regionPtr->containsValueForKey(keyPtr)));
+  } catch (const apache::geode::client::Exception & exception) {
+    ThrowGemfireException(exception);
+  }
+}
+
+NAN_METHOD(Region::Size) {
+  Nan::HandleScope scope;
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  try {
+    info.GetReturnValue().Set(Nan::New<Uint32>(static_cast<uint32_t>(region->regionPtr->size())));
+  } catch (const apache::geode::client::Exception & exception) {
+    ThrowGemfireException(exception);
+  }
+}
+
+class ContainsKeyOnServerWorker : public GemfireWorker {
+ public:
+  ContainsKeyOnServerWorker(
+      const RegionPtr & regionPtr,
+      const CacheableKeyPtr & keyPtr,
+      Nan::Callback * callback) :
+    GemfireWorker(callback),
+    regionPtr(regionPtr),
+    keyPtr(keyPtr),
+    containsKey(false) {}
+
+  void ExecuteGemfireWork() {
+    if (keyPtr == NULLPTR) {
+      SetError("InvalidKeyError", "Invalid GemFire key.");
+      return;
+    }
+    containsKey = regionPtr->containsKeyOnServer(keyPtr);
+  }
+
+  void HandleOKCallback() {
+    Nan::HandleScope scope;
+
+    Local<Value> argv[2] = { Nan::Undefined(), Nan::New(containsKey) };
+    Nan::Call(*callback, 2, argv);
+  }
+
+ private:
+  RegionPtr regionPtr;
+  CacheableKeyPtr keyPtr;
+  bool containsKey;
+};
+
+NAN_METHOD(Region::ContainsKeyOnServer) {
+  Nan::HandleScope scope;
+
+  if (info.Length() == 0) {
+    Nan::ThrowError("You must pass a key and a callback to containsKeyOnServer().");
+    return;
+  }
+
+  int callbackIndex = isOptions(info[1]) ? 2 : 1;
+  if (!info[callbackIndex]->IsFunction()) {
+    Nan::ThrowError("You must pass a function as the callback to containsKeyOnServer().");
+    return;
+  }
+
+  ThreadPool::Lane lane(ThreadPool::POINT_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+
+  CachePtr cachePtr(getCacheFromRegion(region->regionPtr));
+  if (cachePtr == NULLPTR) {
+    return;
+  }
+
+  CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
+  ContainsKeyOnServerWorker * worker = new ContainsKeyOnServerWorker(region->regionPtr, keyPtr, callback);
+  queueKeyWorker(region, worker, lane, keyPtr);
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(Region::SetGetBatching) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !(info[0]->IsObject() || info[0]->IsFalse())) {
+    Nan::ThrowError("You must pass an options object or false to setGetBatching().");
+    return;
+  }
+
+  uint32_t maxBatchSize = 1000;
+
+  if (info[0]->IsObject()) {
+    Local<Value> maxSize(info[0]->ToObject()->Get(Nan::New("maxBatchSize").ToLocalChecked()));
+    if (!maxSize->IsUndefined()) {
+      if (!maxSize->IsNumber() || maxSize->NumberValue() < 1 ||
+          maxSize->NumberValue() != maxSize->Uint32Value()) {
+        Nan::ThrowError("setGetBatching: maxBatchSize must be a positive integer.");
+        return;
+      }
+      maxBatchSize = maxSize->Uint32Value();
+    }
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+
+  if (region->getBatcher != NULL) {
+    region->getBatcher->close();
+    region->getBatcher = NULL;
+  }
+
+  if (info[0]->IsObject()) {
+    region->getBatcher = new GetBatcher(region->regionPtr, maxBatchSize);
+  }
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(Region::SetKeyOrdering) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsBoolean()) {
+    Nan::ThrowError("You must pass a boolean to setKeyOrdering().");
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  region->keyOrdering = info[0]->IsTrue();
+
+  // Ordered operations bypass put coalescing and get batching; send any open batch right away.
+  if (region->keyOrdering) {
+    if (region->putCoalescer != NULL) {
+      region->putCoalescer->flush();
+    }
+    if (region->getBatcher != NULL) {
+      region->getBatcher->flush();
+    }
+  }
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(Region::SetEventConflation) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !(isOptions(info[0]) || info[0]->IsFalse())) {
+    Nan::ThrowError("You must pass an options object or false to setEventConflation().");
+    return;
+  }
+
+  EventStream::Conflation conflation(EventStream::NO_CONFLATION);
+  if (isOptions(info[0])) {
+    conflation = EventStream::CONFLATE_KEEP_OLD_VALUE;
+
+    Local<Value> keepOldValue(
+        Nan::Get(info[0].As<Object>(), Nan::New("keepOldValue").ToLocalChecked()).ToLocalChecked());
+    if (!keepOldValue->IsUndefined()) {
+      if (!keepOldValue->IsBoolean()) {
+        Nan::ThrowError("setEventConflation: keepOldValue must be a boolean.");
+        return;
+      }
+      if (keepOldValue->IsFalse()) {
+        conflation = EventStream::CONFLATE_LATEST_OLD_VALUE;
+      }
+    }
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  RegionEventRegistry::getInstance()->setConflation(region->regionPtr, conflation);
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
 class GetAllWorker : public GemfireWorker {
  public:
   GetAllWorker(
@@ -333,31 +758,32 @@ class GetAllWorker : public GemfireWorker {
     gemfireKeysPtr(gemfireKeysPtr) {}
 
   void ExecuteGemfireWork() {
-    resultsPtr = new HashMapOfCacheable();
+    HashMapOfCacheablePtr resultsPtr(new HashMapOfCacheable());
 
     if (gemfireKeysPtr == NULLPTR) {
       SetError("InvalidKeyError", "Invalid GemFire key.");
       return;
     }
 
-    if (gemfireKeysPtr->size() == 0) {
-      return;
+    if (gemfireKeysPtr->size() > 0) {
+      regionPtr->getAll(*gemfireKeysPtr, resultsPtr, NULLPTR);
     }
 
-    regionPtr->getAll(*gemfireKeysPtr, resultsPtr, NULLPTR);
+    decodedValue.shareArraysFrom(regionPtr);
+    decodedValue.decode(resultsPtr);
   }
 
   void HandleOKCallback() {
     Nan::HandleScope scope;
 
-    Local<Value> argv[2] = { Nan::Undefined(), v8Value(resultsPtr) };
+    Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value() };
     Nan::Call(*callback, 2, argv);
   }
 
  private:
   RegionPtr regionPtr;
   VectorOfCacheableKeyPtr gemfireKeysPtr;
-  HashMapOfCacheablePtr resultsPtr;
+  DecodedValue decodedValue;
 };
 
 NAN_METHOD(Region::GetAll) {
@@ -368,16 +794,22 @@ NAN_METHOD(Region::GetAll) {
     return;
   }
 
-  if (info.Length() == 1) {
+  int callbackIndex = isOptions(info[1]) ? 2 : 1;
+  if (info.Length() <= callbackIndex) {
     Nan::ThrowError("You must pass a callback to getAll().");
     return;
   }
 
-  if (!info[1]->IsFunction()) {
+  if (!info[callbackIndex]->IsFunction()) {
     Nan::ThrowError("You must pass a function as the callback to getAll().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::POINT_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
   RegionPtr regionPtr(region->regionPtr);
 
@@ -388,10 +820,10 @@ NAN_METHOD(Region::GetAll) {
 
   VectorOfCacheableKeyPtr gemfireKeysPtr(gemfireKeys(Local<Array>::Cast(info[0]), cachePtr));
 
-  Nan::Callback * callback = new Nan::Callback(info[1].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
 
   GetAllWorker * worker = new GetAllWorker(regionPtr, gemfireKeysPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -462,10 +894,17 @@ NAN_METHOD(Region::PutAll) {
     Nan::ThrowError("You must pass an object and a callback to putAll().");
     return;
   }
-  if (!isFunctionOrUndefined(info[1])) {
+  int callbackIndex = isOptions(info[1]) ? 2 : 1;
+  if (!isFunctionOrUndefined(info[callbackIndex])) {
     Nan::ThrowError("You must pass a function as the callback to putAll().");
     return;
   }
+
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
   RegionPtr regionPtr(region->regionPtr);
 
@@ -474,10 +913,33 @@ NAN_METHOD(Region::PutAll) {
     return;
   }
 
+  if (isOptions(info[1])) {
+    Local<Object> options(info[1]->ToObject());
+    uint32_t chunkSize = 0;
+    uint32_t maxInFlight = PipelinedPutAll::defaultMaxInFlight;
+    if (!positiveIntegerOption(options, "putAll", "chunkSize", chunkSize) ||
+        !positiveIntegerOption(options, "putAll", "maxInFlight", maxInFlight)) {
+      return;
+    }
+
+    Local<Value> progress(Nan::Get(options, Nan::New("progress").ToLocalChecked()).ToLocalChecked());
+    if (!isFunctionOrUndefined(progress)) {
+      Nan::ThrowError("putAll: progress must be a function.");
+      return;
+    }
+
+    if (chunkSize > 0) {
+      PipelinedPutAll::start(info.Holder(), regionPtr, cachePtr, info[0]->ToObject(), chunkSize,
+                             maxInFlight, lane, getCallback(progress), getCallback(info[callbackIndex]));
+      info.GetReturnValue().Set(info.Holder());
+      return;
+    }
+  }
+
   HashMapOfCacheablePtr hashMapPtr(gemfireHashMap(info[0]->ToObject(), cachePtr));
-  Nan::Callback * callback = getCallback(info[1]);
+  Nan::Callback * callback = getCallback(info[callbackIndex]);
   PutAllWorker * worker = new PutAllWorker(info.Holder(), regionPtr, hashMapPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -513,6 +975,186 @@ NAN_METHOD(Region::PutAllSync) {
   }
 }
 
+// The conditional operations. perform() returns whether the condition held.
+struct PutIfAbsent {
+  static const char * name() { return "putIfAbsent"; }
+
+  // create() only throws EntryExistsException for an entry in the client's local entry map; on a
+  // region with a pool it reaches the server as an ordinary put and would overwrite the server's
+  // value. So only regions without a server, whose local entries are the whole region, qualify.
+  static bool supports(const RegionPtr & regionPtr) {
+    const char * poolName = regionPtr->getAttributes()->getPoolName();
+    return poolName == NULL || poolName[0] == '\0';
+  }
+
+  static bool perform(const RegionPtr & regionPtr,
+                      const CacheableKeyPtr & keyPtr,
+                      const CacheablePtr & valuePtr) {
+    try {
+      regionPtr->create(keyPtr, valuePtr);
+    } catch (const EntryExistsException & exception) {
+      return false;
+    }
+    return true;
+  }
+};
+
+struct RemoveIfEquals {
+  static const char * name() { return "removeIfEquals"; }
+
+  static bool supports(const RegionPtr &) { return true; }
+
+  static bool perform(const RegionPtr & regionPtr,
+                      const CacheableKeyPtr & keyPtr,
+                      const CacheablePtr & valuePtr) {
+    return regionPtr->remove(keyPtr, valuePtr);
+  }
+};
+
+// Throws, rather than skipping the check, on a region where T cannot hold its condition.
+template<typename T>
+static bool supportsConditional(const RegionPtr & regionPtr, const std::string & methodName) {
+  if (T::supports(regionPtr)) {
+    return true;
+  }
+
+  std::stringstream errorMessageStream;
+  errorMessageStream << methodName << "() is only supported on regions without a pool, such as "
+                     << "LOCAL regions; the GemFire native client cannot check and store atomically "
+                     << "on the server.";
+  Nan::ThrowError(errorMessageStream.str().c_str());
+  return false;
+}
+
+template<typename T>
+class ConditionalWorker : public GemfireEventedWorker {
+ public:
+  ConditionalWorker(
+      const Local<Object> & regionObject,
+      const RegionPtr & regionPtr,
+      const CacheableKeyPtr & keyPtr,
+      const CacheablePtr & valuePtr,
+      Nan::Callback * callback) :
+    GemfireEventedWorker(regionObject, callback),
+    regionPtr(regionPtr),
+    keyPtr(keyPtr),
+    valuePtr(valuePtr),
+    succeeded(false) {}
+
+  void ExecuteGemfireWork() {
+    if (keyPtr == NULLPTR) {
+      SetError("InvalidKeyError", "Invalid GemFire key.");
+      return;
+    }
+    if (valuePtr == NULLPTR) {
+      SetError("InvalidValueError", "Invalid GemFire value.");
+      return;
+    }
+    succeeded = T::perform(regionPtr, keyPtr, valuePtr);
+  }
+
+  void HandleOKCallback() {
+    Nan::HandleScope scope;
+    if (callback) {
+      Local<Value> argv[2] = { Nan::Undefined(), Nan::New(succeeded) };
+      Nan::Call(*callback, 2, argv);
+    }
+  }
+
+ private:
+  RegionPtr regionPtr;
+  CacheableKeyPtr keyPtr;
+  CacheablePtr valuePtr;
+  bool succeeded;
+};
+
+template<typename T>
+NAN_METHOD(Region::Conditional) {
+  Nan::HandleScope scope;
+
+  if (info.Length() < 2) {
+    std::stringstream errorMessageStream;
+    errorMessageStream << "You must pass a key and value to " << T::name() << "().";
+    Nan::ThrowError(errorMessageStream.str().c_str());
+    return;
+  }
+
+  int callbackIndex = isOptions(info[2]) ? 3 : 2;
+  if (!isFunctionOrUndefined(info[callbackIndex])) {
+    std::stringstream errorMessageStream;
+    errorMessageStream << "You must pass a function as the callback to " << T::name() << "().";
+    Nan::ThrowError(errorMessageStream.str().c_str());
+    return;
+  }
+
+  ThreadPool::Lane lane(ThreadPool::POINT_LANE);
+  if (!laneOption(info[2], lane)) {
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+
+  CachePtr cachePtr(getCacheFromRegion(region->regionPtr));
+  if (cachePtr == NULLPTR) {
+    return;
+  }
+
+  if (!supportsConditional<T>(region->regionPtr, T::name())) {
+    return;
+  }
+
+  CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
+  CacheablePtr valuePtr(gemfireValue(info[1], cachePtr));
+
+  Nan::Callback * callback = getCallback(info[callbackIndex]);
+  ConditionalWorker<T> * worker =
+    new ConditionalWorker<T>(info.Holder(), region->regionPtr, keyPtr, valuePtr, callback);
+  queueKeyWorker(region, worker, lane, keyPtr);
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
+template<typename T>
+NAN_METHOD(Region::ConditionalSync) {
+  Nan::HandleScope scope;
+
+  if (info.Length() != 2) {
+    std::stringstream errorMessageStream;
+    errorMessageStream << "You must pass a key and value to " << T::name() << "Sync().";
+    Nan::ThrowError(errorMessageStream.str().c_str());
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+
+  CachePtr cachePtr(getCacheFromRegion(region->regionPtr));
+  if (cachePtr == NULLPTR) {
+    return;
+  }
+
+  if (!supportsConditional<T>(region->regionPtr, std::string(T::name()) + "Sync")) {
+    return;
+  }
+
+  CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
+  if (keyPtr == NULLPTR) {
+    Nan::ThrowError("Invalid GemFire key.");
+    return;
+  }
+
+  CacheablePtr valuePtr(gemfireValue(info[1], cachePtr));
+  if (valuePtr == NULLPTR) {
+    Nan::ThrowError("Invalid GemFire value.");
+    return;
+  }
+
+  try {
+    info.GetReturnValue().Set(Nan::New(T::perform(region->regionPtr, keyPtr, valuePtr)));
+  } catch (const apache::geode::client::Exception & exception) {
+    ThrowGemfireException(exception);
+  }
+}
+
 class RemoveWorker : public GemfireEventedWorker {
  public:
   RemoveWorker(
@@ -549,11 +1191,17 @@ NAN_METHOD(Region::Remove) {
     return;
   }
 
-  if (!isFunctionOrUndefined(info[1])) {
+  int callbackIndex = isOptions(info[1]) ? 2 : 1;
+  if (!isFunctionOrUndefined(info[callbackIndex])) {
     Nan::ThrowError("You must pass a function as the callback to remove().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::POINT_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
   RegionPtr regionPtr(region->regionPtr);
 
@@ -563,9 +1211,193 @@ NAN_METHOD(Region::Remove) {
   }
 
   CacheableKeyPtr keyPtr(gemfireKey(info[0], cachePtr));
-  Nan::Callback * callback = getCallback(info[1]);
+  Nan::Callback * callback = getCallback(info[callbackIndex]);
   RemoveWorker * worker = new RemoveWorker(info.Holder(), regionPtr, keyPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueKeyWorker(region, worker, lane, keyPtr);
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
+// Converts the keys that can be used as GemFire keys, sorting the JavaScript keys into validKeys
+// and invalidKeys, so that removeAll() can act on the valid keys and report the invalid ones
+// individually.
+static VectorOfCacheableKeyPtr validGemfireKeys(const Local<Array> & v8Keys,
+                                                const CachePtr & cachePtr,
+                                                const Local<Array> & validKeys,
+                                                const Local<Array> & invalidKeys) {
+  VectorOfCacheableKeyPtr vectorPtr(new VectorOfCacheableKey());
+
+  for (unsigned int i = 0; i < v8Keys->Length(); i++) {
+    Local<Value> v8Key(v8Keys->Get(i));
+    CacheableKeyPtr keyPtr(gemfireKey(v8Key, cachePtr));
+
+    if (keyPtr == NULLPTR) {
+      Nan::Set(invalidKeys, invalidKeys->Length(), v8Key);
+    } else {
+      Nan::Set(validKeys, validKeys->Length(), v8Key);
+      vectorPtr->push_back(keyPtr);
+    }
+  }
+
+  return vectorPtr;
+}
+
+// failedKeys are known not to have been removed. When the removeAll() call itself fails, it may
+// have removed some of the valid keys before failing, so those are reported as unknownKeys.
+static void setRemoveAllKeys(const Local<Value> & error,
+                             const Local<Value> & failedKeys,
+                             const Local<Value> & unknownKeys) {
+  Nan::Set(error.As<Object>(), Nan::New("failedKeys").ToLocalChecked(), failedKeys);
+  Nan::Set(error.As<Object>(), Nan::New("unknownKeys").ToLocalChecked(), unknownKeys);
+}
+
+class RemoveAllWorker : public GemfireEventedWorker {
+ public:
+  RemoveAllWorker(
+      const Local<Object> & regionObject,
+      const RegionPtr & regionPtr,
+      const VectorOfCacheableKeyPtr & keysPtr,
+      const Local<Array> & validKeys,
+      const Local<Array> & invalidKeys,
+      Nan::Callback * callback) :
+    GemfireEventedWorker(regionObject, callback),
+    regionPtr(regionPtr),
+    keysPtr(keysPtr),
+    hasInvalidKeys(invalidKeys->Length() > 0),
+    removeAllFailed(false) {
+      SaveToPersistent("validKeys", validKeys);
+      SaveToPersistent("invalidKeys", invalidKeys);
+    }
+
+  void ExecuteGemfireWork() {
+    if (keysPtr->size() > 0) {
+      try {
+        regionPtr->removeAll(*keysPtr);
+      } catch (const apache::geode::client::Exception & exception) {
+        removeAllFailed = true;
+        throw;
+      }
+    }
+
+    if (hasInvalidKeys) {
+      SetError("InvalidKeyError", "Invalid GemFire key.");
+    }
+  }
+
+  void HandleErrorCallback() {
+    Nan::HandleScope scope;
+
+    Local<Value> error(errorObject());
+    Local<Value> unknownKeys(Nan::New<Array>());
+    if (removeAllFailed) {
+      unknownKeys = GetFromPersistent("validKeys");
+    }
+    setRemoveAllKeys(error, GetFromPersistent("invalidKeys"), unknownKeys);
+
+    if (callback) {
+      Local<Value> argv[1] = { error };
+      Nan::Call(*callback, 1, argv);
+    } else {
+      emitError(GetFromPersistent("v8Object")->ToObject(), error);
+    }
+  }
+
+ private:
+  RegionPtr regionPtr;
+  VectorOfCacheableKeyPtr keysPtr;
+  bool hasInvalidKeys;
+  bool removeAllFailed;
+};
+
+NAN_METHOD(Region::RemoveAll) {
+  Nan::HandleScope scope;
+
+  if (info.Length() == 0 || !info[0]->IsArray()) {
+    Nan::ThrowError("You must pass an array of keys to removeAll().");
+    return;
+  }
+
+  int callbackIndex = isOptions(info[1]) ? 2 : 1;
+  if (!isFunctionOrUndefined(info[callbackIndex])) {
+    Nan::ThrowError("You must pass a function as the callback to removeAll().");
+    return;
+  }
+
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  RegionPtr regionPtr(region->regionPtr);
+
+  CachePtr cachePtr(getCacheFromRegion(region->regionPtr));
+  if (cachePtr == NULLPTR) {
+    return;
+  }
+
+  Local<Array> v8Keys(Local<Array>::Cast(info[0]));
+  Local<Array> validKeys(Nan::New<Array>());
+  Local<Array> invalidKeys(Nan::New<Array>());
+  Nan::TryCatch tryCatch;
+  VectorOfCacheableKeyPtr keysPtr(validGemfireKeys(v8Keys, cachePtr, validKeys, invalidKeys));
+  if (tryCatch.HasCaught()) {
+    tryCatch.ReThrow();
+    return;
+  }
+
+  Nan::Callback * callback = getCallback(info[callbackIndex]);
+  RemoveAllWorker * worker =
+    new RemoveAllWorker(info.Holder(), regionPtr, keysPtr, validKeys, invalidKeys, callback);
+  queueGemfireWorker(worker, lane);
+
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(Region::RemoveAllSync) {
+  Nan::HandleScope scope;
+
+  if (info.Length() != 1 || !info[0]->IsArray()) {
+    Nan::ThrowError("You must pass an array of keys to removeAllSync().");
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  RegionPtr regionPtr(region->regionPtr);
+
+  CachePtr cachePtr(getCacheFromRegion(region->regionPtr));
+  if (cachePtr == NULLPTR) {
+    return;
+  }
+
+  Local<Array> v8Keys(Local<Array>::Cast(info[0]));
+  Local<Array> validKeys(Nan::New<Array>());
+  Local<Array> invalidKeys(Nan::New<Array>());
+  Nan::TryCatch tryCatch;
+  VectorOfCacheableKeyPtr keysPtr(validGemfireKeys(v8Keys, cachePtr, validKeys, invalidKeys));
+  if (tryCatch.HasCaught()) {
+    tryCatch.ReThrow();
+    return;
+  }
+
+  try {
+    if (keysPtr->size() > 0) {
+      regionPtr->removeAll(*keysPtr);
+    }
+  } catch (const apache::geode::client::Exception & exception) {
+    Local<Value> error(v8Error(exception));
+    setRemoveAllKeys(error, invalidKeys, validKeys);
+    Nan::ThrowError(error);
+    return;
+  }
+
+  if (invalidKeys->Length() > 0) {
+    Local<Value> error(Nan::Error("Invalid GemFire key."));
+    Nan::Set(error.As<Object>(), Nan::New("name").ToLocalChecked(), Nan::New("InvalidKeyError").ToLocalChecked());
+    setRemoveAllKeys(error, invalidKeys, Nan::New<Array>());
+    Nan::ThrowError(error);
+    return;
+  }
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -764,27 +1596,33 @@ template<typename T>
 NAN_METHOD(Region::Query) {
   Nan::HandleScope scope;
 
-  if (info.Length() < 2) {
+  int callbackIndex = isOptions(info[1]) ? 2 : 1;
+  if (info.Length() <= callbackIndex) {
     std::stringstream errorStream;
     errorStream << "You must pass a query predicate string and a callback to " << T::name() << ".";
     Nan::ThrowError(errorStream.str().c_str());
     return;
   }
 
-  if (!info[1]->IsFunction()) {
+  if (!info[callbackIndex]->IsFunction()) {
     std::stringstream errorStream;
     errorStream << "You must pass a function as the callback to " << T::name() << ".";
     Nan::ThrowError(errorStream.str().c_str());
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[1], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
 
   std::string queryPredicate(*Nan::Utf8String(info[0]));
-  Nan::Callback * callback = new Nan::Callback(info[1].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
 
   T * worker = new T(region->regionPtr, queryPredicate, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -798,38 +1636,45 @@ class ServerKeysWorker : public GemfireWorker {
     regionPtr(regionPtr) {}
 
   void ExecuteGemfireWork() {
-    keysVectorPtr = new VectorOfCacheableKey();
+    VectorOfCacheableKeyPtr keysVectorPtr(new VectorOfCacheableKey());
     regionPtr->serverKeys(*keysVectorPtr);
+    decodedValue.decode(keysVectorPtr);
   }
 
   void HandleOKCallback() {
-    Local<Value> argv[2] = { Nan::Undefined(), v8Value(keysVectorPtr) };
+    Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value() };
     Nan::Call(*callback, 2, argv);
   }
 
  private:
   RegionPtr regionPtr;
-  VectorOfCacheableKeyPtr keysVectorPtr;
+  DecodedValue decodedValue;
 };
 
 NAN_METHOD(Region::ServerKeys) {
   Nan::HandleScope scope;
 
-  if (info.Length() == 0) {
+  int callbackIndex = isOptions(info[0]) ? 1 : 0;
+  if (info.Length() <= callbackIndex) {
     Nan::ThrowError("You must pass a callback to serverKeys().");
     return;
   }
 
-  if (!info[0]->IsFunction()) {
+  if (!info[callbackIndex]->IsFunction()) {
     Nan::ThrowError("You must pass a function as the callback to serverKeys().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[0], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
-  Nan::Callback * callback = new Nan::Callback(info[0].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
 
   ServerKeysWorker * worker = new ServerKeysWorker(region->regionPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 }
 
 class KeysWorker : public GemfireWorker {
@@ -841,38 +1686,45 @@ class KeysWorker : public GemfireWorker {
     regionPtr(regionPtr) {}
 
   void ExecuteGemfireWork() {
-    keysVectorPtr = new VectorOfCacheableKey();
+    VectorOfCacheableKeyPtr keysVectorPtr(new VectorOfCacheableKey());
     regionPtr->keys(*keysVectorPtr);
+    decodedValue.decode(keysVectorPtr);
   }
 
   void HandleOKCallback() {
-    Local<Value> argv[2] = { Nan::Undefined(), v8Value(keysVectorPtr) };
+    Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value() };
     Nan::Call(*callback, 2, argv);
   }
 
  private:
   RegionPtr regionPtr;
-  VectorOfCacheableKeyPtr keysVectorPtr;
+  DecodedValue decodedValue;
 };
 
 NAN_METHOD(Region::Keys) {
   Nan::HandleScope scope;
 
-  if (info.Length() == 0) {
+  int callbackIndex = isOptions(info[0]) ? 1 : 0;
+  if (info.Length() <= callbackIndex) {
     Nan::ThrowError("You must pass a callback to keys().");
     return;
   }
 
-  if (!info[0]->IsFunction()) {
+  if (!info[callbackIndex]->IsFunction()) {
     Nan::ThrowError("You must pass a function as the callback to keys().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[0], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
-  Nan::Callback * callback = new Nan::Callback(info[0].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
 
   KeysWorker * worker = new KeysWorker(region->regionPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 }
 
 NAN_METHOD(Region::RegisterAllKeys) {
@@ -906,38 +1758,45 @@ class ValuesWorker : public GemfireWorker {
     regionPtr(regionPtr) {}
 
   void ExecuteGemfireWork() {
-    valuesVectorPtr = new VectorOfCacheable();
+    VectorOfCacheablePtr valuesVectorPtr(new VectorOfCacheable());
     regionPtr->values(*valuesVectorPtr);
+    decodedValue.decode(valuesVectorPtr);
   }
 
   void HandleOKCallback() {
-    Local<Value> argv[2] = { Nan::Undefined(), v8Value(valuesVectorPtr) };
+    Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value() };
     Nan::Call(*callback, 2, argv);
   }
 
  private:
   RegionPtr regionPtr;
-  VectorOfCacheablePtr valuesVectorPtr;
+  DecodedValue decodedValue;
 };
 
 NAN_METHOD(Region::Values) {
   Nan::HandleScope scope;
 
-  if (info.Length() == 0) {
+  int callbackIndex = isOptions(info[0]) ? 1 : 0;
+  if (info.Length() <= callbackIndex) {
     Nan::ThrowError("You must pass a callback to values().");
     return;
   }
 
-  if (!info[0]->IsFunction()) {
+  if (!info[callbackIndex]->IsFunction()) {
     Nan::ThrowError("You must pass a function as the callback to values().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[0], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
-  Nan::Callback * callback = new Nan::Callback(info[0].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
 
   ValuesWorker * worker = new ValuesWorker(region->regionPtr, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
 }
 
 class EntriesWorker : public GemfireWorker {
@@ -951,18 +1810,19 @@ class EntriesWorker : public GemfireWorker {
     recursive(recursive) {}
 
   void ExecuteGemfireWork() {
-    regionEntryVector = new VectorOfRegionEntry();
-    regionPtr->entries(*regionEntryVector, recursive);
+    regionPtr->entries(regionEntries, recursive);
+    decodedValue.decode(regionEntries);
   }
 
   void HandleOKCallback() {
-    Local<Value> argv[2] = { Nan::Undefined(), v8Value(*regionEntryVector) };
+    Local<Value> argv[2] = { Nan::Undefined(), decodedValue.v8Value() };
     Nan::Call(*callback, 2, argv);
   }
 
  private:
   RegionPtr regionPtr;
-  VectorOfRegionEntry* regionEntryVector;
+  VectorOfRegionEntry regionEntries;
+  DecodedValue decodedValue;
   bool recursive;
 };
 
@@ -970,21 +1830,86 @@ class EntriesWorker : public GemfireWorker {
 NAN_METHOD(Region::Entries) {
   Nan::HandleScope scope;
 
-  if (info.Length() == 0) {
+  int callbackIndex = isOptions(info[0]) ? 1 : 0;
+  if (info.Length() <= callbackIndex) {
     Nan::ThrowError("You must pass a callback to entries().");
     return;
   }
 
-  if (!info[0]->IsFunction()) {
+  if (!info[callbackIndex]->IsFunction()) {
     Nan::ThrowError("You must pass a function as the callback to entries().");
     return;
   }
 
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!laneOption(info[0], lane)) {
+    return;
+  }
+
   Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
-  Nan::Callback * callback = new Nan::Callback(info[0].As<Function>());
+  Nan::Callback * callback = new Nan::Callback(info[callbackIndex].As<Function>());
 
   EntriesWorker * worker = new EntriesWorker(region->regionPtr, callback, true);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, lane);
+}
+
+// Reads the chunkSize and lane options shared by the iterate*() methods.
+static bool iteratorOptions(const Local<Value> & options,
+                            const char * methodName,
+                            size_t & chunkSize,
+                            ThreadPool::Lane & lane) {
+  if (!options->IsUndefined() && !isOptions(options)) {
+    std::stringstream errorMessageStream;
+    errorMessageStream << "You must pass an options object or nothing to " << methodName << "().";
+    Nan::ThrowError(errorMessageStream.str().c_str());
+    return false;
+  }
+
+  if (!laneOption(options, lane)) {
+    return false;
+  }
+
+  if (options->IsUndefined()) {
+    return true;
+  }
+
+  uint32_t chunkSizeOption = chunkSize;
+  if (!positiveIntegerOption(options.As<Object>(), methodName, "chunkSize", chunkSizeOption)) {
+    return false;
+  }
+
+  chunkSize = chunkSizeOption;
+  return true;
+}
+
+template<RegionIterator::Kind kind>
+static void iterate(const Nan::FunctionCallbackInfo<Value> & info, const char * methodName) {
+  Nan::HandleScope scope;
+
+  size_t chunkSize(RegionIterator::defaultChunkSize);
+  ThreadPool::Lane lane(ThreadPool::BULK_LANE);
+  if (!iteratorOptions(info[0], methodName, chunkSize, lane)) {
+    return;
+  }
+
+  Region * region = Nan::ObjectWrap::Unwrap<Region>(info.Holder());
+  info.GetReturnValue().Set(RegionIterator::NewInstance(region->regionPtr, kind, chunkSize, lane));
+}
+
+NAN_METHOD(Region::IterateKeys) {
+  iterate<RegionIterator::KEYS>(info, "iterateKeys");
+}
+
+NAN_METHOD(Region::IterateServerKeys) {
+  iterate<RegionIterator::SERVER_KEYS>(info, "iterateServerKeys");
+}
+
+NAN_METHOD(Region::IterateValues) {
+  iterate<RegionIterator::VALUES>(info, "iterateValues");
+}
+
+NAN_METHOD(Region::IterateEntries) {
+  iterate<RegionIterator::ENTRIES>(info, "iterateEntries");
 }
 
 class DestroyRegionWorker : public GemfireEventedWorker {
@@ -1023,7 +1948,7 @@ NAN_METHOD(Region::DestroyRegion) {
 
   Nan::Callback * callback = getCallback(info[0]);
   DestroyRegionWorker * worker = new DestroyRegionWorker(info.Holder(), region, callback, false);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, ThreadPool::BULK_LANE);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -1040,7 +1965,7 @@ NAN_METHOD(Region::LocalDestroyRegion) {
 
   Nan::Callback * callback = getCallback(info[0]);
   DestroyRegionWorker * worker = new DestroyRegionWorker(info.Holder(), region, callback);
-  Nan::AsyncQueueWorker(worker);
+  queueGemfireWorker(worker, ThreadPool::BULK_LANE);
 
   info.GetReturnValue().Set(info.Holder());
 }
@@ -1056,14 +1981,29 @@ NAN_MODULE_INIT(Region::Init){
   Nan::SetPrototypeMethod(constructorTemplate, "clear", Region::Clear);
   Nan::SetPrototypeMethod(constructorTemplate, "put", Region::Put);
   Nan::SetPrototypeMethod(constructorTemplate, "putSync",Region::PutSync);
+  Nan::SetPrototypeMethod(constructorTemplate, "setPutCoalescing", Region::SetPutCoalescing);
   Nan::SetPrototypeMethod(constructorTemplate, "get", Region::Get);
   Nan::SetPrototypeMethod(constructorTemplate, "getSync",Region::GetSync);
+  Nan::SetPrototypeMethod(constructorTemplate, "setGetBatching", Region::SetGetBatching);
+  Nan::SetPrototypeMethod(constructorTemplate, "setKeyOrdering", Region::SetKeyOrdering);
+  Nan::SetPrototypeMethod(constructorTemplate, "setEventConflation", Region::SetEventConflation);
+  Nan::SetPrototypeMethod(constructorTemplate, "peek", Region::Peek);
+  Nan::SetPrototypeMethod(constructorTemplate, "containsKey", Region::ContainsKey);
+  Nan::SetPrototypeMethod(constructorTemplate, "containsValueForKey", Region::ContainsValueForKey);
+  Nan::SetPrototypeMethod(constructorTemplate, "containsKeyOnServer", Region::ContainsKeyOnServer);
+  Nan::SetPrototypeMethod(constructorTemplate, "size", Region::Size);
   Nan::SetPrototypeMethod(constructorTemplate, "getAll", Region::GetAll);
   Nan::SetPrototypeMethod(constructorTemplate, "getAllSync", Region::GetAllSync);
   Nan::SetPrototypeMethod(constructorTemplate, "entries", Region::Entries);
   Nan::SetPrototypeMethod(constructorTemplate, "putAll", Region::PutAll);
   Nan::SetPrototypeMethod(constructorTemplate, "putAllSync", Region::PutAllSync);
   Nan::SetPrototypeMethod(constructorTemplate, "remove", Region::Remove);
+  Nan::SetPrototypeMethod(constructorTemplate, "removeAll", Region::RemoveAll);
+  Nan::SetPrototypeMethod(constructorTemplate, "putIfAbsent", Region::Conditional<PutIfAbsent>);
+  Nan::SetPrototypeMethod(constructorTemplate, "putIfAbsentSync", Region::ConditionalSync<PutIfAbsent>);
+  Nan::SetPrototypeMethod(constructorTemplate, "removeIfEquals", Region::Conditional<RemoveIfEquals>);
+  Nan::SetPrototypeMethod(constructorTemplate, "removeIfEqualsSync", Region::ConditionalSync<RemoveIfEquals>);
+  Nan::SetPrototypeMethod(constructorTemplate, "removeAllSync", Region::RemoveAllSync);
   Nan::SetPrototypeMethod(constructorTemplate, "query",  Region::Query<QueryWorker>);
   Nan::SetPrototypeMethod(constructorTemplate, "selectValue",  Region::Query<SelectValueWorker>);
   Nan::SetPrototypeMethod(constructorTemplate, "existsValue", Region::Query<ExistsValueWorker>);
@@ -1071,6 +2011,10 @@ NAN_MODULE_INIT(Region::Init){
   Nan::SetPrototypeMethod(constructorTemplate, "serverKeys",  Region::ServerKeys);
   Nan::SetPrototypeMethod(constructorTemplate, "keys", Region::Keys);
   Nan::SetPrototypeMethod(constructorTemplate, "values", Region::Values);
+  Nan::SetPrototypeMethod(constructorTemplate, "iterateKeys", Region::IterateKeys);
+  Nan::SetPrototypeMethod(constructorTemplate, "iterateServerKeys", Region::IterateServerKeys);
+  Nan::SetPrototypeMethod(constructorTemplate, "iterateValues", Region::IterateValues);
+  Nan::SetPrototypeMethod(constructorTemplate, "iterateEntries", Region::IterateEntries);
   Nan::SetPrototypeMethod(constructorTemplate, "inspect", Region::Inspect);
   Nan::SetPrototypeMethod(constructorTemplate, "registerAllKeys", Region::RegisterAllKeys);
   Nan::SetPrototypeMethod(constructorTemplate, "unregisterAllKeys",  Region::UnregisterAllKeys);
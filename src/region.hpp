@@ -6,6 +6,8 @@
 #include <node.h>
 #include <geode/Region.hpp>
 #include "region_event_registry.hpp"
+#include "put_coalescer.hpp"
+#include "get_batcher.hpp"
 
 namespace node_gemfire {
 
@@ -13,10 +15,20 @@ class Region : public Nan::ObjectWrap {
 
  public:
   Region(apache::geode::client::RegionPtr regionPtr) :
-    regionPtr(regionPtr) {}
+    regionPtr(regionPtr),
+    putCoalescer(NULL),
+    getBatcher(NULL),
+    keyOrdering(false),
+    eventMask(0) {}
 
   virtual ~Region() {
     RegionEventRegistry::getInstance()->remove(this);
+    if (putCoalescer != NULL) {
+      putCoalescer->close();
+    }
+    if (getBatcher != NULL) {
+      getBatcher->close();
+    }
   }
 
   static NAN_MODULE_INIT(Init);
@@ -25,17 +37,32 @@ class Region : public Nan::ObjectWrap {
   static NAN_METHOD(Clear);
   static NAN_METHOD(Put);
   static NAN_METHOD(PutSync);
+  static NAN_METHOD(SetPutCoalescing);
   static NAN_METHOD(Get);
   static NAN_METHOD(GetSync);
+  static NAN_METHOD(SetGetBatching);
+  static NAN_METHOD(SetKeyOrdering);
+  static NAN_METHOD(SetEventConflation);
+  static NAN_METHOD(Peek);
+  static NAN_METHOD(ContainsKey);
+  static NAN_METHOD(ContainsValueForKey);
+  static NAN_METHOD(ContainsKeyOnServer);
+  static NAN_METHOD(Size);
   static NAN_METHOD(GetAll);
   static NAN_METHOD(GetAllSync);
   static NAN_METHOD(Entries);
   static NAN_METHOD(PutAll);
   static NAN_METHOD(PutAllSync);
   static NAN_METHOD(Remove);
+  static NAN_METHOD(RemoveAll);
+  static NAN_METHOD(RemoveAllSync);
   static NAN_METHOD(ServerKeys);
   static NAN_METHOD(Keys);
   static NAN_METHOD(Values);
+  static NAN_METHOD(IterateKeys);
+  static NAN_METHOD(IterateServerKeys);
+  static NAN_METHOD(IterateValues);
+  static NAN_METHOD(IterateEntries);
   static NAN_METHOD(ExecuteFunction);
   static NAN_METHOD(RegisterAllKeys);
   static NAN_METHOD(UnregisterAllKeys);
@@ -48,7 +75,19 @@ class Region : public Nan::ObjectWrap {
   template<typename T>
   static NAN_METHOD(Query);
 
+  template<typename T>
+  static NAN_METHOD(Conditional);
+
+  template<typename T>
+  static NAN_METHOD(ConditionalSync);
+
   apache::geode::client::RegionPtr regionPtr;
+  PutCoalescer * putCoalescer;
+  GetBatcher * getBatcher;
+  bool keyOrdering;
+
+  // The RegionEventListener::EventType values this wrapper has JavaScript listeners for.
+  unsigned int eventMask;
 
   private:
     static inline Nan::Persistent<v8::Function> & constructor() {
@@ -4,14 +4,32 @@
 using namespace apache::geode::client;
 
 namespace node_gemfire {
+unsigned int RegionEventListener::eventType(const std::string & eventName) {
+  if (eventName == "create") {
+    return CREATE_EVENT;
+  } else if (eventName == "update") {
+    return UPDATE_EVENT;
+  } else if (eventName == "destroy") {
+    return DESTROY_EVENT;
+  } else if (eventName == "batch") {
+    return BATCH_EVENTS;
+  }
+  return 0;
+}
 void RegionEventListener::afterCreate(const EntryEvent & event) {
-  RegionEventRegistry::getInstance()->emit("create", event);
+  if (eventMask & CREATE_EVENT) {
+    RegionEventRegistry::getInstance()->emit("create", event, conflation);
+  }
 }
 void RegionEventListener::afterUpdate(const EntryEvent & event) {
-  RegionEventRegistry::getInstance()->emit("update", event);
+  if (eventMask & UPDATE_EVENT) {
+    RegionEventRegistry::getInstance()->emit("update", event, conflation);
+  }
 }
 void RegionEventListener::afterDestroy(const EntryEvent & event) {
-  RegionEventRegistry::getInstance()->emit("destroy", event);
+  if (eventMask & DESTROY_EVENT) {
+    RegionEventRegistry::getInstance()->emit("destroy", event, conflation);
+  }
 }
 RegionEventRegistry RegionEventRegistry::instance = RegionEventRegistry();
 }  // namespace node_gemfire
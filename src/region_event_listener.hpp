@@ -2,17 +2,47 @@
 #define __REGION_EVENT_LISTENER_HPP__
 
 #include <geode/CacheListener.hpp>
+#include <atomic>
+#include <string>
+#include "event_stream.hpp"
 
 namespace node_gemfire {
 
+// Installed on a region only while a JavaScript wrapper of it has listeners for entry events.
+// Events of types outside the mask are dropped on the GemFire thread, before they are copied.
 class RegionEventListener : public apache::geode::client::CacheListener {
  public:
-  RegionEventListener() {}
+  enum EventType {
+    CREATE_EVENT = 1,
+    UPDATE_EVENT = 2,
+    DESTROY_EVENT = 4,
+    ENTRY_EVENTS = CREATE_EVENT | UPDATE_EVENT | DESTROY_EVENT,
+
+    // Set in a wrapper's mask while it has "batch" listeners, which receive every entry event.
+    BATCH_EVENTS = 8
+  };
+
+  // The mask bit for a JavaScript event name, or 0 for names that are not captured.
+  static unsigned int eventType(const std::string & eventName);
+
+  RegionEventListener(unsigned int eventMask, EventStream::Conflation conflation) :
+    eventMask(eventMask),
+    conflation(conflation) {}
+
+  void setEventMask(unsigned int mask) { eventMask = mask; }
+  void setConflation(EventStream::Conflation newConflation) { conflation = newConflation; }
+
   virtual void afterCreate(const apache::geode::client::EntryEvent & event);
   virtual void afterUpdate(const apache::geode::client::EntryEvent & event);
   virtual void afterDestroy(const apache::geode::client::EntryEvent & event);
+
+ private:
+  std::atomic<unsigned int> eventMask;
+  std::atomic<EventStream::Conflation> conflation;
 };
 
+typedef apache::geode::client::SharedPtr<RegionEventListener> RegionEventListenerPtr;
+
 }  // namespace node_gemfire
 
 #endif
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cassert>
+#include <map>
 #include <set>
 #include <vector>
 #include "events.hpp"
@@ -14,18 +15,85 @@ namespace node_gemfire {
 void RegionEventRegistry::add(node_gemfire::Region * region) {
   assert(region->regionPtr != NULLPTR);
 
-  AttributesMutatorPtr attrMutatorPtr(region->regionPtr->getAttributesMutator());
-  attrMutatorPtr->setCacheListener(listener);
-
   regionSet.insert(region);
 }
 
 void RegionEventRegistry::remove(node_gemfire::Region * region) {
   regionSet.erase(region);
+  updateCapture(region->regionPtr);
+}
+
+void RegionEventRegistry::updateCapture(node_gemfire::Region * region) {
+  updateCapture(region->regionPtr);
+}
+
+void RegionEventRegistry::updateCapture(const RegionPtr & regionPtr) {
+  unsigned int eventMask = 0;
+  for (std::set<Region *>::iterator iterator(regionSet.begin());
+       iterator != regionSet.end();
+       ++iterator) {
+    if ((*iterator)->regionPtr == regionPtr) {
+      eventMask |= (*iterator)->eventMask;
+    }
+  }
+
+  if (eventMask & RegionEventListener::BATCH_EVENTS) {
+    eventMask |= RegionEventListener::ENTRY_EVENTS;
+  }
+
+  std::map<apache::geode::client::Region *, RegionEventListenerPtr>::iterator
+    listener(listeners.find(regionPtr.ptr()));
+
+  try {
+    if (listener != listeners.end()) {
+      if (eventMask != 0) {
+        listener->second->setEventMask(eventMask);
+      } else {
+        listeners.erase(listener);
+        regionPtr->getAttributesMutator()->setCacheListener(NULLPTR);
+      }
+    } else if (eventMask != 0) {
+      std::map<apache::geode::client::Region *, EventStream::Conflation>::iterator
+        conflation(conflations.find(regionPtr.ptr()));
+      RegionEventListenerPtr listenerPtr(new RegionEventListener(eventMask,
+          conflation == conflations.end() ? EventStream::NO_CONFLATION : conflation->second));
+      regionPtr->getAttributesMutator()->setCacheListener(listenerPtr);
+      listeners[regionPtr.ptr()] = listenerPtr;
+    }
+  } catch (const apache::geode::client::Exception & exception) {
+    // A destroyed region, or a region of a closed cache, delivers no more events. This also runs
+    // from ~Region, so nothing may be thrown.
+    listeners.erase(regionPtr.ptr());
+  }
+}
+
+void RegionEventRegistry::emit(const std::string & eventName,
+                               const EntryEvent & event,
+                               EventStream::Conflation conflation) {
+  eventStream->add(eventName, event, conflation);
+}
+
+void RegionEventRegistry::setConflation(const RegionPtr & regionPtr,
+                                        EventStream::Conflation conflation) {
+  if (conflation == EventStream::NO_CONFLATION) {
+    conflations.erase(regionPtr.ptr());
+  } else {
+    conflations[regionPtr.ptr()] = conflation;
+  }
+
+  std::map<apache::geode::client::Region *, RegionEventListenerPtr>::iterator
+    listener(listeners.find(regionPtr.ptr()));
+  if (listener != listeners.end()) {
+    listener->second->setConflation(conflation);
+  }
 }
 
-void RegionEventRegistry::emit(const std::string & eventName, const EntryEvent & event) {
-  eventStream->add(new EventStream::Event(eventName, event));
+void RegionEventRegistry::setEventQueueCapacity(size_t capacity, EventStream::Overflow overflow) {
+  eventStream->setCapacity(capacity, overflow);
+}
+
+EventStream::Stats RegionEventRegistry::eventStats() {
+  return eventStream->stats();
 }
 
 RegionEventRegistry * RegionEventRegistry::getInstance() {
@@ -37,28 +105,69 @@ void RegionEventRegistry::emitCallback(uv_async_t * async, int status) {
   regionEventRegistry->publishEvents();
 }
 
+// Emits each event to the wrappers of its region that listen for its type, then emits one
+// "batch" event per wrapper with "batch" listeners, holding all of its region's events.
 void RegionEventRegistry::publishEvents() {
   Nan::HandleScope scope;
 
-  std::vector<EventStream::Event *> eventVector(eventStream->nextEvents());
+  EventStream::Event * event(eventStream->nextEvents());
+  if (event == NULL) {
+    return;
+  }
 
-  for (std::vector<EventStream::Event *>::iterator iterator(eventVector.begin());
-       iterator != eventVector.end();
+  std::vector<Region *> batchRegions;
+  for (std::set<Region *>::iterator iterator(regionSet.begin());
+       iterator != regionSet.end();
        ++iterator) {
-    EventStream::Event * event(*iterator);
-    Local<Object> eventPayload(event->v8Object());
+    if ((*iterator)->eventMask & RegionEventListener::BATCH_EVENTS) {
+      batchRegions.push_back(*iterator);
+    }
+  }
 
+  std::vector<Local<Array> > batches;
+  for (size_t i = 0; i < batchRegions.size(); i++) {
+    batches.push_back(Nan::New<Array>());
+  }
+
+  while (event != NULL) {
+    std::string eventName(event->getName());
+    unsigned int type = RegionEventListener::eventType(eventName);
+    RegionPtr regionPtr(event->getRegion());
+
+    Local<Object> eventPayload;
     for (std::set<Region *>::iterator iterator(regionSet.begin());
          iterator != regionSet.end();
          ++iterator) {
       Region * region(*iterator);
-      Local<Object> regionObject(region->handle());
-      if (region->regionPtr == event->getRegion()) {
-        emitEvent(regionObject, event->getName().c_str(), eventPayload);
+      if (region->regionPtr == regionPtr && (region->eventMask & type)) {
+        if (eventPayload.IsEmpty()) {
+          eventPayload = event->v8Object();
+        }
+        emitEvent(region->handle(), eventName.c_str(), eventPayload);
       }
     }
 
+    Local<Object> batchPayload;
+    for (size_t i = 0; i < batchRegions.size(); i++) {
+      if (batchRegions[i]->regionPtr == regionPtr) {
+        if (batchPayload.IsEmpty()) {
+          batchPayload = event->v8Object();
+          Nan::Set(batchPayload, Nan::New("type").ToLocalChecked(),
+              Nan::New(eventName).ToLocalChecked());
+        }
+        Nan::Set(batches[i], batches[i]->Length(), batchPayload);
+      }
+    }
+
+    EventStream::Event * next(event->next);
     delete event;
+    event = next;
+  }
+
+  for (size_t i = 0; i < batchRegions.size(); i++) {
+    if (batches[i]->Length() > 0) {
+      emitEvent(batchRegions[i]->handle(), "batch", batches[i]);
+    }
   }
 }
 
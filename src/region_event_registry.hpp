@@ -3,6 +3,7 @@
 
 #include <geode/Region.hpp>
 #include <geode/EntryEvent.hpp>
+#include <map>
 #include <string>
 #include <set>
 #include "region_event_listener.hpp"
@@ -15,20 +16,34 @@ class Region;
 class RegionEventRegistry {
  public:
   RegionEventRegistry() :
-    listener(new RegionEventListener),
     eventStream(new EventStream(this, (uv_async_cb) emitCallback)) {}
 
   static void emitCallback(uv_async_t * async, int status);
 
   void add(node_gemfire::Region * region);
   void remove(node_gemfire::Region * region);
-  void emit(const std::string & eventName, const apache::geode::client::EntryEvent & event);
+
+  // Installs, updates or removes the listener of the region's GemFire region to capture the event
+  // types that any of its wrappers has listeners for. Called when region->eventMask changes.
+  void updateCapture(node_gemfire::Region * region);
+
+  void emit(const std::string & eventName,
+            const apache::geode::client::EntryEvent & event,
+            EventStream::Conflation conflation);
+
+  // Sets how events of a GemFire region are conflated, for all of its wrappers.
+  void setConflation(const apache::geode::client::RegionPtr & regionPtr,
+                     EventStream::Conflation conflation);
+  void setEventQueueCapacity(size_t capacity, EventStream::Overflow overflow);
+  EventStream::Stats eventStats();
   static RegionEventRegistry * getInstance();
 
  private:
   void publishEvents();
+  void updateCapture(const apache::geode::client::RegionPtr & regionPtr);
 
-  apache::geode::client::CacheListenerPtr listener;
+  std::map<apache::geode::client::Region *, RegionEventListenerPtr> listeners;
+  std::map<apache::geode::client::Region *, EventStream::Conflation> conflations;
   static RegionEventRegistry instance;
   std::set<node_gemfire::Region *> regionSet;
   EventStream * eventStream;
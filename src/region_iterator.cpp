@@ -0,0 +1,193 @@
+#include "region_iterator.hpp"
+#include <geode/GeodeCppCache.hpp>
+#include <algorithm>
+#include "decoded_value.hpp"
+#include "gemfire_worker.hpp"
+
+using namespace v8;
+using namespace apache::geode::client;
+
+namespace node_gemfire {
+
+class NextChunkWorker : public GemfireWorker {
+ public:
+  NextChunkWorker(
+      const Local<Object> & iteratorObject,
+      RegionIterator * iterator,
+      Nan::Callback * callback) :
+    GemfireWorker(callback),
+    iterator(iterator),
+    closed(iterator->closed),
+    done(false) {
+      SaveToPersistent("iteratorObject", iteratorObject);
+    }
+
+  void ExecuteGemfireWork() {
+    if (closed) {
+      done = true;
+      return;
+    }
+
+    if (!iterator->loaded) {
+      switch (iterator->kind) {
+        case RegionIterator::KEYS:
+          iterator->regionPtr->keys(iterator->keys);
+          break;
+        case RegionIterator::SERVER_KEYS:
+          iterator->regionPtr->serverKeys(iterator->keys);
+          break;
+        case RegionIterator::VALUES:
+          iterator->regionPtr->values(iterator->values);
+          break;
+        case RegionIterator::ENTRIES:
+          iterator->regionPtr->entries(iterator->entries, true);
+          break;
+      }
+      iterator->loaded = true;
+    }
+
+    size_t begin = iterator->position;
+    size_t length = iterator->length();
+    if (begin >= length) {
+      done = true;
+      iterator->release();
+      return;
+    }
+
+    size_t end = std::min(begin + iterator->chunkSize, length);
+    switch (iterator->kind) {
+      case RegionIterator::KEYS:
+      case RegionIterator::SERVER_KEYS:
+        decodedValue.decode(iterator->keys, begin, end);
+        for (size_t i = begin; i < end; i++) {
+          iterator->keys[i] = NULLPTR;
+        }
+        break;
+      case RegionIterator::VALUES:
+        decodedValue.decode(iterator->values, begin, end);
+        for (size_t i = begin; i < end; i++) {
+          iterator->values[i] = NULLPTR;
+        }
+        break;
+      case RegionIterator::ENTRIES:
+        decodedValue.decode(iterator->entries, begin, end);
+        for (size_t i = begin; i < end; i++) {
+          iterator->entries[i] = NULLPTR;
+        }
+        break;
+    }
+
+    iterator->position = end;
+    if (end == length) {
+      iterator->release();
+    }
+  }
+
+  void HandleOKCallback() {
+    Nan::HandleScope scope;
+    finish();
+
+    Local<Value> argv[2] = { Nan::Undefined(), done ? Nan::Null() : decodedValue.v8Value() };
+    Nan::Call(*callback, 2, argv);
+  }
+
+  void HandleErrorCallback() {
+    Nan::HandleScope scope;
+    finish();
+
+    Local<Value> argv[1] = { errorObject() };
+    Nan::Call(*callback, 1, argv);
+  }
+
+ private:
+  void finish() {
+    iterator->pending = false;
+    if (iterator->closed) {
+      iterator->release();
+    }
+  }
+
+  RegionIterator * iterator;
+  bool closed;
+  bool done;
+  DecodedValue decodedValue;
+};
+
+NAN_MODULE_INIT(RegionIterator::Init) {
+  Nan::HandleScope scope;
+
+  Local<FunctionTemplate> constructorTemplate = Nan::New<FunctionTemplate>();
+
+  constructorTemplate->SetClassName(Nan::New("RegionIterator").ToLocalChecked());
+  constructorTemplate->InstanceTemplate()->SetInternalFieldCount(1);
+
+  Nan::SetPrototypeMethod(constructorTemplate, "next", RegionIterator::Next);
+  Nan::SetPrototypeMethod(constructorTemplate, "close", RegionIterator::Close);
+
+  constructor().Reset(Nan::GetFunction(constructorTemplate).ToLocalChecked());
+
+  Nan::Set(target, Nan::New("RegionIterator").ToLocalChecked(), Nan::GetFunction(constructorTemplate).ToLocalChecked());
+}
+
+Local<Object> RegionIterator::NewInstance(const RegionPtr & regionPtr,
+                                          Kind kind,
+                                          size_t chunkSize,
+                                          ThreadPool::Lane lane) {
+  Nan::EscapableHandleScope scope;
+  const unsigned int argc = 0;
+  Local<Value> argv[argc] = {};
+  Local<Object> instance(Nan::New(RegionIterator::constructor())->NewInstance(argc, argv));
+  RegionIterator * iterator = new RegionIterator(regionPtr, kind, chunkSize, lane);
+  iterator->Wrap(instance);
+
+  return scope.Escape(instance);
+}
+
+size_t RegionIterator::length() const {
+  switch (kind) {
+    case VALUES:
+      return values.size();
+    case ENTRIES:
+      return entries.size();
+    default:
+      return keys.size();
+  }
+}
+
+void RegionIterator::release() {
+  keys.clear();
+  values.clear();
+  entries.clear();
+}
+
+NAN_METHOD(RegionIterator::Next) {
+  Nan::HandleScope scope;
+
+  if (info.Length() == 0 || !info[0]->IsFunction()) {
+    Nan::ThrowError("You must pass a callback to next().");
+    return;
+  }
+
+  RegionIterator * iterator = Nan::ObjectWrap::Unwrap<RegionIterator>(info.Holder());
+  if (iterator->pending) {
+    Nan::ThrowError("next() was called before the previous chunk was delivered.");
+    return;
+  }
+
+  iterator->pending = true;
+  Nan::Callback * callback = new Nan::Callback(info[0].As<Function>());
+  NextChunkWorker * worker = new NextChunkWorker(info.Holder(), iterator, callback);
+  queueGemfireWorker(worker, iterator->lane);
+}
+
+NAN_METHOD(RegionIterator::Close) {
+  Nan::HandleScope scope;
+
+  RegionIterator * iterator = Nan::ObjectWrap::Unwrap<RegionIterator>(info.Holder());
+  iterator->closed = true;
+  if (!iterator->pending) {
+    iterator->release();
+  }
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,78 @@
+#ifndef __REGION_ITERATOR_HPP__
+#define __REGION_ITERATOR_HPP__
+
+#include <v8.h>
+#include <nan.h>
+#include <geode/GeodeCppCache.hpp>
+#include "thread_pool.hpp"
+
+namespace node_gemfire {
+
+// Hands the keys, values or entries of a region to JavaScript in fixed-size chunks. The region is
+// read on the first call to next(); each later call decodes one chunk on a worker thread and
+// drops the native references to it, so the memory held shrinks as the chunks are consumed. A
+// chunk is only decoded when it is asked for, which gives the caller control over the pace.
+class RegionIterator : public Nan::ObjectWrap {
+ public:
+  enum Kind {
+    KEYS,
+    SERVER_KEYS,
+    VALUES,
+    ENTRIES
+  };
+
+  RegionIterator(const apache::geode::client::RegionPtr & regionPtr,
+                 Kind kind,
+                 size_t chunkSize,
+                 ThreadPool::Lane lane) :
+    regionPtr(regionPtr),
+    kind(kind),
+    chunkSize(chunkSize),
+    lane(lane),
+    loaded(false),
+    position(0),
+    pending(false),
+    closed(false) {}
+
+  static NAN_MODULE_INIT(Init);
+  static v8::Local<v8::Object> NewInstance(const apache::geode::client::RegionPtr & regionPtr,
+                                           Kind kind,
+                                           size_t chunkSize,
+                                           ThreadPool::Lane lane);
+
+  static NAN_METHOD(Next);
+  static NAN_METHOD(Close);
+
+  static const size_t defaultChunkSize = 1000;
+
+ private:
+  friend class NextChunkWorker;
+
+  size_t length() const;
+  void release();
+
+  apache::geode::client::RegionPtr regionPtr;
+  Kind kind;
+  size_t chunkSize;
+  ThreadPool::Lane lane;
+
+  // Only touched by the worker of the pending next() call, or on the event loop when no call is
+  // pending.
+  bool loaded;
+  size_t position;
+  apache::geode::client::VectorOfCacheableKey keys;
+  apache::geode::client::VectorOfCacheable values;
+  apache::geode::client::VectorOfRegionEntry entries;
+
+  bool pending;
+  bool closed;
+
+  static inline Nan::Persistent<v8::Function> & constructor() {
+    static Nan::Persistent<v8::Function> my_constructor;
+    return my_constructor;
+  }
+};
+
+}  // namespace node_gemfire
+
+#endif
@@ -1,19 +1,43 @@
 #include "result_stream.hpp"
+#include <algorithm>
 
 using namespace apache::geode::client;
 
 namespace node_gemfire {
 
+size_t ResultStream::capacityLimit = ResultStream::defaultCapacity;
+size_t ResultStream::highWaterMark = 0;
+std::atomic<uint64_t> ResultStream::blockedResults(0);
+std::set<ResultStream *> ResultStream::streams;
+
 void ResultStream::add(const CacheablePtr & resultPtr) {
+  if (capacity > 0 && queuedResults.load() >= capacity) {
+    waitForSpace();
+  }
+
+  queuedResults++;
+  if (results.push(new Result(resultPtr))) {
+    uv_async_send(resultsAsync);
+  }
+}
+
+// The slow path of add(). waitingProducers is raised before queuedResults is read again, and
+// nextResults() lowers queuedResults before it reads waitingProducers, so either this thread sees
+// the room or nextResults() sees the waiting producer and wakes it.
+void ResultStream::waitForSpace() {
+  blockedResults++;
   uv_mutex_lock(&resultsMutex);
-  resultsPtr->push_back(resultPtr);
+  waitingProducers++;
+  while (queuedResults.load() >= capacity) {
+    uv_cond_wait(&resultsTakenCond, &resultsMutex);
+  }
+  waitingProducers--;
   uv_mutex_unlock(&resultsMutex);
-  uv_async_send(resultsAsync);
 }
 
 void ResultStream::end() {
   uv_mutex_lock(&resultsProcessedMutex);
-  while (resultsPtr->size() > 0) {
+  while (queuedResults.load() > 0) {
     uv_cond_wait(&resultsProcessedCond, &resultsProcessedMutex);
   }
   uv_mutex_unlock(&resultsProcessedMutex);
@@ -27,22 +51,45 @@ void ResultStream::resultsProcessed() {
   uv_mutex_unlock(&resultsProcessedMutex);
 }
 
-CacheableVectorPtr ResultStream::nextResults() {
-  uv_mutex_lock(&resultsMutex);
-
-  CacheableVectorPtr returnValue = CacheableVector::create();
+ResultStream::Result * ResultStream::nextResults() {
+  size_t count;
+  Result * result(results.drain(count));
+  queuedResults -= count;
+  highWaterMark = std::max(highWaterMark, count);
 
-  for (CacheableVector::Iterator iterator(resultsPtr->begin());
-       iterator != resultsPtr->end();
-       ++iterator) {
-    returnValue->push_back(*iterator);
+  if (waitingProducers.load() > 0) {
+    uv_mutex_lock(&resultsMutex);
+    uv_cond_broadcast(&resultsTakenCond);
+    uv_mutex_unlock(&resultsMutex);
   }
 
-  resultsPtr->clear();
+  return result;
+}
 
-  uv_mutex_unlock(&resultsMutex);
+void ResultStream::deleteResults(Result * result) {
+  while (result != NULL) {
+    Result * next(result->next);
+    delete result;
+    result = next;
+  }
+}
 
-  return returnValue;
+void ResultStream::setCapacity(size_t capacity) {
+  capacityLimit = capacity;
+}
+
+ResultStream::Stats ResultStream::stats() {
+  Stats stats;
+  stats.pendingResults = 0;
+  for (std::set<ResultStream *>::iterator iterator(streams.begin());
+       iterator != streams.end();
+       ++iterator) {
+    stats.pendingResults += (*iterator)->queuedResults.load();
+  }
+  stats.highWaterMark = highWaterMark;
+  stats.blockedResults = blockedResults.load();
+  stats.capacity = capacityLimit;
+  return stats;
 }
 
 void ResultStream::deleteHandle(uv_handle_t * handle) {
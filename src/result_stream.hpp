@@ -3,42 +3,84 @@
 
 #include <geode/CacheableBuiltins.hpp>
 #include <uv.h>
+#include <atomic>
+#include <set>
+#include "mpsc_queue.hpp"
 
 namespace node_gemfire {
 
+// Hands results from the GemFire threads to the event loop through a lock-free queue. Once about
+// capacity results are waiting, add() blocks until the loop has taken them, so a slow listener
+// holds up the function execution instead of buffering its results without limit.
 class ResultStream {
  public:
+  struct Stats {
+    size_t pendingResults;
+    size_t highWaterMark;
+    uint64_t blockedResults;
+    size_t capacity;
+  };
+
+  struct Result {
+    explicit Result(const apache::geode::client::CacheablePtr & resultPtr) :
+      resultPtr(resultPtr),
+      next(NULL) {}
+
+    apache::geode::client::CacheablePtr resultPtr;
+    Result * next;
+  };
+
   explicit ResultStream(void * worker,
                         uv_async_cb resultsCallback,
                         uv_async_cb endCallback) :
     resultsAsync(new uv_async_t),
     endAsync(new uv_async_t),
-    resultsPtr(apache::geode::client::CacheableVector::create()) {
+    capacity(capacityLimit),
+    queuedResults(0),
+    waitingProducers(0) {
       uv_mutex_init(&resultsMutex);
       uv_mutex_init(&resultsProcessedMutex);
       uv_cond_init(&resultsProcessedCond);
+      uv_cond_init(&resultsTakenCond);
       resultsAsync->data = worker;
       endAsync->data = worker;
       uv_async_init(uv_default_loop(), resultsAsync, resultsCallback);
       uv_async_init(uv_default_loop(), endAsync, endCallback);
+      streams.insert(this);
     }
 
   ~ResultStream() {
+    streams.erase(this);
     uv_close(reinterpret_cast<uv_handle_t *>(endAsync), deleteHandle);
     uv_close(reinterpret_cast<uv_handle_t *>(resultsAsync), deleteHandle);
+    deleteResults(nextResults());
     uv_mutex_destroy(&resultsMutex);
     uv_mutex_destroy(&resultsProcessedMutex);
     uv_cond_destroy(&resultsProcessedCond);
+    uv_cond_destroy(&resultsTakenCond);
   }
 
   void add(const apache::geode::client::CacheablePtr & resultPtr);
   void end();
   void resultsProcessed();
 
-  apache::geode::client::CacheableVectorPtr nextResults();
+  // Takes the waiting results, oldest first, as a list linked through Result::next. The caller
+  // deletes them.
+  Result * nextResults();
+  static void deleteResults(Result * result);
+
+  // The capacity of the streams created afterwards; 0 means no limit.
+  static void setCapacity(size_t capacity);
+
+  // Sums the results waiting in all streams. Called on the event loop, like the constructor and
+  // destructor.
+  static Stats stats();
+
+  static const size_t defaultCapacity = 10000;
 
  private:
   static void deleteHandle(uv_handle_t * handle);
+  void waitForSpace();
 
   uv_mutex_t resultsMutex;
   uv_mutex_t resultsProcessedMutex;
@@ -47,8 +89,18 @@ class ResultStream {
   uv_async_t * endAsync;
 
   uv_cond_t resultsProcessedCond;
+  uv_cond_t resultsTakenCond;
+
+  size_t capacity;
+
+  MpscQueue<Result> results;
+  std::atomic<size_t> queuedResults;
+  std::atomic<unsigned int> waitingProducers;
 
-  apache::geode::client::CacheableVectorPtr resultsPtr;
+  static size_t capacityLimit;
+  static size_t highWaterMark;
+  static std::atomic<uint64_t> blockedResults;
+  static std::set<ResultStream *> streams;
 };
 
 }  // namespace node_gemfire
@@ -1,5 +1,8 @@
 #include <geode/SelectResultsIterator.hpp>
+#include <geode/Struct.hpp>
+#include <cstring>
 #include <sstream>
+#include <vector>
 #include "conversions.hpp"
 #include "select_results.hpp"
 
@@ -36,17 +39,87 @@ Local<Object> SelectResults::NewInstance(const SelectResultsPtr & selectResultsP
   return scope.Escape(instance);
 }
 
+// Converts the rows of one result set. Every Struct row of a projection query has the same field
+// names, so their handles are created for the first row and reused for the rest. Must live inside
+// the caller's HandleScope.
+class RowConverter {
+ public:
+  explicit RowConverter(bool tuples) :
+    tuples(tuples) {}
+
+  Local<Value> v8Row(const SerializablePtr & rowPtr) {
+    CacheablePtr valuePtr(static_cast<CacheablePtr>(rowPtr));
+    if (valuePtr == NULLPTR || valuePtr->typeId() != GeodeTypeIds::Struct) {
+      return v8Value(valuePtr);
+    }
+
+    StructPtr structPtr(static_cast<StructPtr>(valuePtr));
+    unsigned int length = structPtr->length();
+
+    if (tuples) {
+      Local<Array> tuple(Nan::New<Array>(length));
+      for (unsigned int i = 0; i < length; i++) {
+        Nan::Set(tuple, i, v8Value((*structPtr)[i]));
+      }
+      return tuple;
+    }
+
+    resolveFieldNames(structPtr);
+
+    Local<Object> v8Object(Nan::New<Object>());
+    for (unsigned int i = 0; i < length; i++) {
+      Nan::Set(v8Object, v8FieldNames[i], v8Value((*structPtr)[i]));
+    }
+    return v8Object;
+  }
+
+ private:
+  void resolveFieldNames(const StructPtr & structPtr) {
+    unsigned int length = structPtr->length();
+
+    bool matches = (fieldNames.size() == length);
+    for (unsigned int i = 0; matches && i < length; i++) {
+      const char * fieldName = structPtr->getFieldName(i);
+      matches = (fieldName == fieldNames[i] || strcmp(fieldName, fieldNames[i]) == 0);
+    }
+    if (matches) {
+      return;
+    }
+
+    fieldNames.clear();
+    v8FieldNames.clear();
+    for (unsigned int i = 0; i < length; i++) {
+      fieldNames.push_back(structPtr->getFieldName(i));
+      v8FieldNames.push_back(Nan::New(fieldNames.back()).ToLocalChecked());
+    }
+  }
+
+  bool tuples;
+  std::vector<const char *> fieldNames;
+  std::vector< Local<String> > v8FieldNames;
+};
+
+static bool tuplesOption(const Local<Value> & optionsValue) {
+  if (!optionsValue->IsObject() || optionsValue->IsFunction()) {
+    return false;
+  }
+
+  Local<Value> tuples(Nan::Get(optionsValue->ToObject(), Nan::New("tuples").ToLocalChecked()).ToLocalChecked());
+  return tuples->BooleanValue();
+}
+
 NAN_METHOD(SelectResults::ToArray) {
   Nan::HandleScope scope;
 
   SelectResults * selectResults = Nan::ObjectWrap::Unwrap<SelectResults>(info.Holder());
   SelectResultsPtr selectResultsPtr(selectResults->selectResultsPtr);
 
+  RowConverter rowConverter(tuplesOption(info[0]));
   unsigned int length = selectResultsPtr->size();
 
   Local<Array> array(Nan::New<Array>(length));
   for (unsigned int i = 0; i < length; i++) {
-    array->Set(i, v8Value((*selectResultsPtr)[i]));
+    array->Set(i, rowConverter.v8Row((*selectResultsPtr)[i]));
   }
   info.GetReturnValue().Set(array);
 }
@@ -54,7 +127,14 @@ NAN_METHOD(SelectResults::ToArray) {
 NAN_METHOD(SelectResults::Each) {
   Nan::HandleScope scope;
 
-  if (info.Length() == 0 || !info[0]->IsFunction()) {
+  Local<Value> options(Nan::Undefined());
+  Local<Value> callbackValue(info[0]);
+  if (!callbackValue->IsFunction()) {
+    options = info[0];
+    callbackValue = info[1];
+  }
+
+  if (!callbackValue->IsFunction()) {
     Nan::ThrowError("You must pass a callback to each()");
     info.GetReturnValue().Set(Nan::Undefined());
     return;
@@ -64,11 +144,12 @@ NAN_METHOD(SelectResults::Each) {
   SelectResultsPtr selectResultsPtr(selectResults->selectResultsPtr);
 
   SelectResultsIterator iterator(selectResultsPtr->getIterator());
-  Nan::Callback callback(Local<Function>::Cast(info[0]));
+  Nan::Callback callback(Local<Function>::Cast(callbackValue));
+  RowConverter rowConverter(tuplesOption(options));
 
   while (iterator.hasNext()) {
     const unsigned int argc = 1;
-    Local<Value> argv[argc] = { v8Value(iterator.next()) };
+    Local<Value> argv[argc] = { rowConverter.v8Row(iterator.next()) };
     callback(1, argv);
   }
   info.GetReturnValue().Set(info.Holder());
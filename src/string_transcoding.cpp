@@ -0,0 +1,175 @@
+#include "string_transcoding.hpp"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NODE_GEMFIRE_X86_KERNELS 1
+#endif
+
+namespace node_gemfire {
+
+static void widenUtf16Scalar(const uint16_t * source, wchar_t * destination, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    destination[i] = source[i];
+  }
+}
+
+static void narrowToUtf16Scalar(const wchar_t * source, uint16_t * destination, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    destination[i] = static_cast<uint16_t>(source[i]);
+  }
+}
+
+static bool isAsciiScalar(const char * source, size_t length) {
+  unsigned char accumulator = 0;
+  for (size_t i = 0; i < length; i++) {
+    accumulator |= static_cast<unsigned char>(source[i]);
+  }
+  return (accumulator & 0x80) == 0;
+}
+
+#if defined(NODE_GEMFIRE_X86_KERNELS) && defined(__SSE2__)
+
+static void widenUtf16Sse2(const uint16_t * source, wchar_t * destination, size_t length) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), _mm_unpacklo_epi16(units, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i + 4), _mm_unpackhi_epi16(units, zero));
+  }
+  widenUtf16Scalar(source + i, destination + i, length - i);
+}
+
+// Sign-extending the low 16 bits makes the saturating pack keep them exactly, which truncates the
+// same way the scalar cast does.
+static inline __m128i lowHalvesSse2(const wchar_t * source) {
+  __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+  return _mm_srai_epi32(_mm_slli_epi32(units, 16), 16);
+}
+
+static void narrowToUtf16Sse2(const wchar_t * source, uint16_t * destination, size_t length) {
+  size_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    __m128i packed = _mm_packs_epi32(lowHalvesSse2(source + i), lowHalvesSse2(source + i + 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), packed);
+  }
+  narrowToUtf16Scalar(source + i, destination + i, length - i);
+}
+
+static bool isAsciiSse2(const char * source, size_t length) {
+  __m128i accumulator = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    accumulator = _mm_or_si128(accumulator, _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i)));
+  }
+  return _mm_movemask_epi8(accumulator) == 0 && isAsciiScalar(source + i, length - i);
+}
+
+__attribute__((target("avx2")))
+static void widenUtf16Avx2(const uint16_t * source, wchar_t * destination, size_t length) {
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+    __m256i low = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(units));
+    __m256i high = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(units, 1));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), low);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i + 8), high);
+  }
+  widenUtf16Sse2(source + i, destination + i, length - i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i lowHalvesAvx2(const wchar_t * source) {
+  __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+  return _mm256_srai_epi32(_mm256_slli_epi32(units, 16), 16);
+}
+
+__attribute__((target("avx2")))
+static void narrowToUtf16Avx2(const wchar_t * source, uint16_t * destination, size_t length) {
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    // The pack works within 128-bit lanes, so put the 64-bit quarters back in order afterwards.
+    __m256i packed = _mm256_packs_epi32(lowHalvesAvx2(source + i), lowHalvesAvx2(source + i + 8));
+    packed = _mm256_permute4x64_epi64(packed, 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), packed);
+  }
+  narrowToUtf16Sse2(source + i, destination + i, length - i);
+}
+
+__attribute__((target("avx2")))
+static bool isAsciiAvx2(const char * source, size_t length) {
+  __m256i accumulator = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32) {
+    accumulator = _mm256_or_si256(accumulator,
+                                  _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i)));
+  }
+  return _mm256_movemask_epi8(accumulator) == 0 && isAsciiSse2(source + i, length - i);
+}
+
+static bool hasAvx2() {
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+
+#endif
+
+bool stringFastPaths() {
+  static const char * fastPathsVariable = getenv("NODE_GEMFIRE_STRING_FAST_PATHS");
+  static const bool fastPaths = fastPathsVariable == NULL || strcmp(fastPathsVariable, "0") != 0;
+  return fastPaths;
+}
+
+void widenUtf16(const uint16_t * source, wchar_t * destination, size_t length) {
+  if (sizeof(wchar_t) == sizeof(uint16_t)) {
+    memcpy(destination, source, length * sizeof(uint16_t));
+    return;
+  }
+#if defined(NODE_GEMFIRE_X86_KERNELS) && defined(__SSE2__)
+  if (!stringFastPaths()) {
+    widenUtf16Scalar(source, destination, length);
+  } else if (hasAvx2()) {
+    widenUtf16Avx2(source, destination, length);
+  } else {
+    widenUtf16Sse2(source, destination, length);
+  }
+#else
+  widenUtf16Scalar(source, destination, length);
+#endif
+}
+
+void narrowToUtf16(const wchar_t * source, uint16_t * destination, size_t length) {
+  if (sizeof(wchar_t) == sizeof(uint16_t)) {
+    memcpy(destination, source, length * sizeof(uint16_t));
+    return;
+  }
+#if defined(NODE_GEMFIRE_X86_KERNELS) && defined(__SSE2__)
+  if (!stringFastPaths()) {
+    narrowToUtf16Scalar(source, destination, length);
+  } else if (hasAvx2()) {
+    narrowToUtf16Avx2(source, destination, length);
+  } else {
+    narrowToUtf16Sse2(source, destination, length);
+  }
+#else
+  narrowToUtf16Scalar(source, destination, length);
+#endif
+}
+
+bool isAscii(const char * source, size_t length) {
+#if defined(NODE_GEMFIRE_X86_KERNELS) && defined(__SSE2__)
+  if (!stringFastPaths()) {
+    return isAsciiScalar(source, length);
+  }
+  if (hasAvx2()) {
+    return isAsciiAvx2(source, length);
+  }
+  return isAsciiSse2(source, length);
+#else
+  return isAsciiScalar(source, length);
+#endif
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,24 @@
+#ifndef __STRING_TRANSCODING_HPP__
+#define __STRING_TRANSCODING_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace node_gemfire {
+
+// V8 hands out strings as UTF-16 code units while GemFire's wide strings are wchar_t, which is
+// 32 bits wide on Linux. These kernels convert between the two one code unit at a time, exactly
+// like the scalar loops they replace, using AVX2 or SSE2 when the CPU supports them.
+
+void widenUtf16(const uint16_t * source, wchar_t * destination, size_t length);
+void narrowToUtf16(const wchar_t * source, uint16_t * destination, size_t length);
+bool isAscii(const char * source, size_t length);
+
+// False when the NODE_GEMFIRE_STRING_FAST_PATHS environment variable is "0". The kernels then run
+// their scalar loops and strings skip the one-byte paths, as before they existed, which gives
+// bin/benchmark_keys.js its baseline.
+bool stringFastPaths();
+
+}  // namespace node_gemfire
+
+#endif
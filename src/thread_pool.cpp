@@ -0,0 +1,231 @@
+#include "thread_pool.hpp"
+#include <uv.h>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+namespace node_gemfire {
+
+static unsigned int initialSize() {
+  const char * sizeVariable = getenv("NODE_GEMFIRE_THREADPOOL_SIZE");
+  if (sizeVariable == NULL) {
+    return ThreadPool::defaultSize;
+  }
+
+  int size = atoi(sizeVariable);
+  if (size < 1) {
+    return ThreadPool::defaultSize;
+  }
+  return size > static_cast<int>(ThreadPool::maxSize) ? ThreadPool::maxSize : size;
+}
+
+ThreadPool & ThreadPool::getInstance() {
+  static ThreadPool * instance = new ThreadPool();
+  return *instance;
+}
+
+ThreadPool::ThreadPool() :
+    size(initialSize()),
+    reservedPointThreads(0),
+    keyWaitingTasks(0),
+    started(false),
+    outstandingTasks(0) {
+  uv_mutex_init(&mutex);
+  uv_cond_init(&workAvailable);
+  for (int lane = 0; lane < LANE_COUNT; lane++) {
+    laneStats[lane] = LaneStats();
+  }
+  for (unsigned int shard = 0; shard < keyShardCount; shard++) {
+    keyShards[shard].active = false;
+  }
+}
+
+void ThreadPool::start() {
+  uv_async_init(uv_default_loop(), &completedAsync, completedCallback);
+  completedAsync.data = this;
+  uv_unref(reinterpret_cast<uv_handle_t *>(&completedAsync));
+  started = true;
+}
+
+void ThreadPool::queue(Task * task, Lane lane) {
+  queueTask(task, lane, -1);
+}
+
+void ThreadPool::queue(Task * task, Lane lane, uint32_t key) {
+  queueTask(task, lane, key % keyShardCount);
+}
+
+void ThreadPool::queueTask(Task * task, Lane lane, int shard) {
+  if (!started) {
+    start();
+  }
+
+  // The pending completion keeps the loop alive, as a uv_work_t would.
+  if (outstandingTasks++ == 0) {
+    uv_ref(reinterpret_cast<uv_handle_t *>(&completedAsync));
+  }
+
+  QueuedTask queuedTask;
+  queuedTask.task = task;
+  queuedTask.lane = lane;
+  queuedTask.shard = shard;
+  queuedTask.queuedAt = uv_hrtime();
+
+  uv_mutex_lock(&mutex);
+  if (shard >= 0 && keyShards[shard].active) {
+    keyShards[shard].waitingTasks.push_back(queuedTask);
+    keyWaitingTasks++;
+  } else {
+    if (shard >= 0) {
+      keyShards[shard].active = true;
+    }
+    push(queuedTask);
+  }
+  uv_mutex_unlock(&mutex);
+}
+
+// Called with the mutex held.
+void ThreadPool::push(const QueuedTask & queuedTask) {
+  pendingTasks[queuedTask.lane].push_back(queuedTask);
+
+  // Threads are started on demand, up to the pool size.
+  size_t busyThreads = laneStats[POINT_LANE].busyThreads + laneStats[BULK_LANE].busyThreads;
+  size_t queueDepth = pendingTasks[POINT_LANE].size() + pendingTasks[BULK_LANE].size();
+  if (busyThreads + queueDepth > threads.size() && threads.size() < size) {
+    Thread * thread = new Thread();
+    thread->pool = this;
+    thread->index = threads.size();
+    threads.push_back(thread);
+    uv_thread_create(&thread->thread, threadMain, thread);
+  }
+
+  // A thread that cannot take bulk work may be woken first, so wake them all.
+  uv_cond_broadcast(&workAvailable);
+}
+
+// Called on a pool thread with the mutex held, once a keyed task has executed, to release the
+// shard's next task.
+void ThreadPool::finishShard(int index) {
+  KeyShard & shard(keyShards[index]);
+  if (shard.waitingTasks.empty()) {
+    shard.active = false;
+    return;
+  }
+
+  QueuedTask queuedTask(shard.waitingTasks.front());
+  shard.waitingTasks.pop_front();
+  keyWaitingTasks--;
+  push(queuedTask);
+}
+
+void ThreadPool::setSize(unsigned int newSize, unsigned int newReservedPointThreads) {
+  uv_mutex_lock(&mutex);
+  size = newSize;
+  reservedPointThreads = newReservedPointThreads;
+
+  // Threads beyond the new size stay parked rather than exiting; waking them all lets any
+  // threads that are now within the size pick up queued work.
+  uv_cond_broadcast(&workAvailable);
+  uv_mutex_unlock(&mutex);
+}
+
+ThreadPool::Stats ThreadPool::stats() {
+  uv_mutex_lock(&mutex);
+  Stats stats;
+  stats.size = size;
+  stats.reservedPointThreads = reservedPointThreads;
+  stats.threads = threads.size();
+  stats.busyThreads = 0;
+  stats.queueDepth = 0;
+  stats.keyWaitingTasks = keyWaitingTasks;
+  stats.completedTasks = 0;
+  for (int lane = 0; lane < LANE_COUNT; lane++) {
+    stats.lanes[lane] = laneStats[lane];
+    stats.lanes[lane].queueDepth = pendingTasks[lane].size();
+    stats.busyThreads += laneStats[lane].busyThreads;
+    stats.queueDepth += pendingTasks[lane].size();
+    stats.completedTasks += laneStats[lane].completedTasks;
+  }
+  uv_mutex_unlock(&mutex);
+  return stats;
+}
+
+void ThreadPool::threadMain(void * arg) {
+  Thread * thread = static_cast<Thread *>(arg);
+  thread->pool->run(thread->index);
+}
+
+// Called with the mutex held.
+bool ThreadPool::nextLane(Lane & lane) {
+  if (!pendingTasks[POINT_LANE].empty()) {
+    lane = POINT_LANE;
+    return true;
+  }
+
+  unsigned int bulkThreads = size > reservedPointThreads ? size - reservedPointThreads : 1;
+  if (!pendingTasks[BULK_LANE].empty() && laneStats[BULK_LANE].busyThreads < bulkThreads) {
+    lane = BULK_LANE;
+    return true;
+  }
+
+  return false;
+}
+
+void ThreadPool::run(unsigned int index) {
+  Lane lane = POINT_LANE;
+
+  uv_mutex_lock(&mutex);
+  for (;;) {
+    while (index >= size || !nextLane(lane)) {
+      uv_cond_wait(&workAvailable, &mutex);
+    }
+
+    QueuedTask queuedTask(pendingTasks[lane].front());
+    pendingTasks[lane].pop_front();
+
+    LaneStats & stats(laneStats[lane]);
+    uint64_t queueNanos = uv_hrtime() - queuedTask.queuedAt;
+    stats.totalQueueNanos += queueNanos;
+    if (queueNanos > stats.maxQueueNanos) {
+      stats.maxQueueNanos = queueNanos;
+    }
+    stats.busyThreads++;
+    uv_mutex_unlock(&mutex);
+
+    queuedTask.task->execute();
+
+    uv_mutex_lock(&mutex);
+    stats.busyThreads--;
+    stats.completedTasks++;
+    completedTasks.push_back(queuedTask.task);
+    uv_async_send(&completedAsync);
+
+    if (queuedTask.shard >= 0) {
+      finishShard(queuedTask.shard);
+    }
+  }
+}
+
+void ThreadPool::completedCallback(uv_async_t * async) {
+  static_cast<ThreadPool *>(async->data)->completeTasks();
+}
+
+void ThreadPool::completeTasks() {
+  std::vector<Task *> tasks;
+  uv_mutex_lock(&mutex);
+  tasks.swap(completedTasks);
+  uv_mutex_unlock(&mutex);
+
+  for (std::vector<Task *>::iterator iterator(tasks.begin());
+       iterator != tasks.end();
+       ++iterator) {
+    (*iterator)->complete();
+  }
+
+  outstandingTasks -= tasks.size();
+  if (outstandingTasks == 0) {
+    uv_unref(reinterpret_cast<uv_handle_t *>(&completedAsync));
+  }
+}
+
+}  // namespace node_gemfire
@@ -0,0 +1,123 @@
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <uv.h>
+#include <deque>
+#include <vector>
+
+namespace node_gemfire {
+
+// Runs blocking GemFire calls on threads of its own, so that they neither wait behind nor hold up
+// the fs, dns and zlib work that shares libuv's default pool. Tasks are queued and completed on
+// the event loop; only execute() runs on a pool thread.
+//
+// Tasks are queued in one of two lanes. Idle threads always take point work (single-key gets,
+// puts and removes) before bulk work (scans, queries, putAll and functions), and a number of
+// threads can be reserved so that bulk work never occupies the whole pool.
+//
+// Tasks queued with a key are ordered: tasks whose keys fall in the same shard run one at a time in
+// the order they were queued, while tasks in different shards run in parallel.
+class ThreadPool {
+ public:
+  class Task {
+   public:
+    virtual ~Task() {}
+
+    // Called on a pool thread.
+    virtual void execute() = 0;
+
+    // Called on the event loop once execute() has returned. The pool does not touch the task
+    // afterwards, so the task may delete itself here.
+    virtual void complete() = 0;
+  };
+
+  enum Lane {
+    POINT_LANE,
+    BULK_LANE,
+    LANE_COUNT
+  };
+
+  struct LaneStats {
+    unsigned int busyThreads;
+    size_t queueDepth;
+    uint64_t completedTasks;
+    uint64_t totalQueueNanos;
+    uint64_t maxQueueNanos;
+  };
+
+  struct Stats {
+    unsigned int size;
+    unsigned int reservedPointThreads;
+    unsigned int threads;
+    unsigned int busyThreads;
+    size_t queueDepth;
+    size_t keyWaitingTasks;
+    uint64_t completedTasks;
+    LaneStats lanes[LANE_COUNT];
+  };
+
+  static ThreadPool & getInstance();
+
+  // The following are called from the event loop.
+  void queue(Task * task, Lane lane);
+  void queue(Task * task, Lane lane, uint32_t key);
+  void setSize(unsigned int size, unsigned int reservedPointThreads);
+  Stats stats();
+
+  static const unsigned int defaultSize = 4;
+  static const unsigned int maxSize = 1024;
+  static const unsigned int keyShardCount = 256;
+
+ private:
+  ThreadPool();
+
+  struct Thread {
+    ThreadPool * pool;
+    unsigned int index;
+    uv_thread_t thread;
+  };
+
+  struct QueuedTask {
+    Task * task;
+    Lane lane;
+    int shard;
+    uint64_t queuedAt;
+  };
+
+  // Tasks for a shard wait here while an earlier task for the shard is queued or running.
+  struct KeyShard {
+    bool active;
+    std::deque<QueuedTask> waitingTasks;
+  };
+
+  void start();
+  void queueTask(Task * task, Lane lane, int shard);
+  void push(const QueuedTask & queuedTask);
+  void finishShard(int shard);
+  void run(unsigned int index);
+  bool nextLane(Lane & lane);
+  void completeTasks();
+
+  static void threadMain(void * arg);
+  static void completedCallback(uv_async_t * async);
+
+  uv_mutex_t mutex;
+  uv_cond_t workAvailable;
+  std::deque<QueuedTask> pendingTasks[LANE_COUNT];
+  KeyShard keyShards[keyShardCount];
+  size_t keyWaitingTasks;
+  std::vector<Task *> completedTasks;
+  std::vector<Thread *> threads;
+  unsigned int size;
+  unsigned int reservedPointThreads;
+  LaneStats laneStats[LANE_COUNT];
+
+  // Only used on the event loop.
+  uv_async_t completedAsync;
+  bool started;
+  size_t outstandingTasks;
+};
+
+}  // namespace node_gemfire
+
+#endif